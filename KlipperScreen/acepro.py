@@ -44,6 +44,7 @@ class Panel(ScreenPanel):
         for instance_id in self.ace_instances:
             self.instance_data[instance_id] = {
                 'connection_state': None,
+                'stale': False,
                 'inventory': [{
                     "material": "Empty",
                     "color": [0, 0, 0],
@@ -151,7 +152,7 @@ class Panel(ScreenPanel):
             if not callable(getattr(direct_ws, "send_method", None)):
                 return True
 
-            objects = {f"ace_instance_{i}": ["connection_state"] for i in self.ace_instances}
+            objects = {f"ace_instance_{i}": ["connection_state", "stale"] for i in self.ace_instances}
 
             def _cb(response, *_):
                 try:
@@ -162,6 +163,9 @@ class Panel(ScreenPanel):
                         val = (status.get(key) or {}).get("connection_state")
                         if val is not None:
                             self.instance_data[instance_id]["connection_state"] = str(val)
+                        stale = (status.get(key) or {}).get("stale")
+                        if stale is not None:
+                            self.instance_data[instance_id]["stale"] = bool(stale)
                     self._update_connection_status_label()
                 except Exception as e:
                     logging.debug(f"ACE: connection poll callback error: {e}")
@@ -183,7 +187,9 @@ class Panel(ScreenPanel):
             if state is None:
                 any_unknown = True
             elif state != "connected":
-                first_issue = first_issue or f"ACE[{instance_id}]: {state}"
+                # Slots still show the last saved status until the first live update
+                cached = " (cached)" if self.instance_data[instance_id].get("stale") else ""
+                first_issue = first_issue or f"ACE[{instance_id}]: {state}{cached}"
         if first_issue is not None:
             self.conn_status_label.set_markup(
                 f'<span foreground="orange"><b>{first_issue}</b></span>'
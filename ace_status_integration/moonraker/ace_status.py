@@ -63,6 +63,9 @@ class AceStatus:
         self.server.register_endpoint(
             "/server/ace/command", ["POST"], self.handle_command_request
         )
+        self.server.register_endpoint(
+            "/server/ace/metrics", ["GET"], self.handle_metrics_request
+        )
 
         # Subscribe to printer status updates
         self.server.register_event_handler(
@@ -214,6 +217,26 @@ class AceStatus:
             return status
         return {"slots": status.get("slots", [])}
 
+    async def handle_metrics_request(self, webrequest: WebRequest) -> Dict[str, Any]:
+        """Handle transport metrics request (latency, traffic, frame errors per unit)."""
+        try:
+            query_result = await self._query_ace_instances()
+            instances: Dict[int, Dict[str, Any]] = query_result["instances"]
+            return {
+                "instances": [
+                    {
+                        "index": idx,
+                        "connection_state": data.get("connection_state", "unknown"),
+                        "transport": data.get("transport", {}),
+                    }
+                    for idx, data in sorted(instances.items())
+                ],
+                "ace_instance_count": query_result["count"],
+            }
+        except Exception as exc:  # noqa: BLE001
+            self.logger.error("Error getting ACE metrics: %s", exc, exc_info=True)
+            return {"error": str(exc)}
+
     async def handle_command_request(self, webrequest: WebRequest) -> Dict[str, Any]:
         """Handle ACE command execution."""
         try:
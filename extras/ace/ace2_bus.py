@@ -3,7 +3,7 @@
 from __future__ import annotations
 
 from dataclasses import dataclass
-from typing import Dict, Iterable, List, Tuple
+from typing import Any, Callable, Container, Dict, Iterable, List, Tuple
 
 
 @dataclass(frozen=True)
@@ -22,7 +22,12 @@ class Ace2DeviceIdentity:
 
 @dataclass
 class Ace2BusDevice:
-    """Track one discovered ACE2 device on a shared RS-485 bus."""
+    """
+    Track one discovered ACE2 device on a shared RS-485 bus.
+
+    ``logical_instance`` and ``device_id`` are changed through the owning
+    Ace2BusSession only, which keeps its lookup indexes in step with them.
+    """
 
     identity: Ace2DeviceIdentity
     logical_instance: int | None = None
@@ -30,18 +35,33 @@ class Ace2BusDevice:
 
 
 class Ace2BusSession:
-    """Track discovered ACE2 devices and their logical-instance bindings."""
+    """
+    Track discovered ACE2 devices and their logical-instance bindings.
+
+    Besides the UID map the session maintains reverse indexes by device id
+    and by logical instance, so demultiplexing a response frame is a single
+    dict lookup however long the daisy chain is. Device ids are unique on
+    the bus: giving an id to one device takes it from any previous holder.
+    The UID order and the assignment-plan order are cached and only re-sorted
+    after a device is added or rebound.
+    """
 
     def __init__(self, port: str, baud: int = 230400) -> None:
         self.port = port
         self.baud = baud
         self._devices_by_identity: Dict[Ace2DeviceIdentity, Ace2BusDevice] = {}
-        self._identity_by_instance: Dict[int, Ace2DeviceIdentity] = {}
+        self._device_by_instance: Dict[int, Ace2BusDevice] = {}
+        self._device_by_id: Dict[int, Ace2BusDevice] = {}
+        self._uid_order: List[Ace2BusDevice] | None = None
+        self._plan_order: List[Ace2BusDevice] | None = None
+        self.last_bringup: Dict[str, Any] | None = None  # Ace2BusBringUp.stats
 
     def reset(self) -> None:
         """Clear runtime discovery and binding state before a fresh bus scan."""
         self._devices_by_identity.clear()
-        self._identity_by_instance.clear()
+        self._device_by_instance.clear()
+        self._device_by_id.clear()
+        self._uid_order = self._plan_order = None
 
     def record_discovered_device(self, uid1: int, uid2: int, uid3: int) -> Ace2BusDevice:
         """Add or return a discovered ACE2 device by UID."""
@@ -50,24 +70,54 @@ class Ace2BusSession:
         if device is None:
             device = Ace2BusDevice(identity=identity)
             self._devices_by_identity[identity] = device
+            self._uid_order = self._plan_order = None
         return device
 
+    def has_discovered(self, uid1: int, uid2: int, uid3: int) -> bool:
+        """Whether a unit with this UID is already known."""
+        return Ace2DeviceIdentity(uid1, uid2, uid3) in self._devices_by_identity
+
+    def discovered_count(self) -> int:
+        return len(self._devices_by_identity)
+
     def bind_logical_instance(self, instance_num: int, uid1: int, uid2: int, uid3: int) -> Ace2BusDevice:
         """Bind a discovered ACE2 device to a logical ACE instance number."""
         device = self.record_discovered_device(uid1, uid2, uid3)
-        previous_identity = self._identity_by_instance.get(instance_num)
-        if previous_identity and previous_identity != device.identity:
-            self._devices_by_identity[previous_identity].logical_instance = None
+        previous = self._device_by_instance.get(instance_num)
+        if previous is device:
+            return device
+        if previous is not None:
+            previous.logical_instance = None
+        if device.logical_instance is not None:
+            # Moving to another instance releases the old one
+            self._device_by_instance.pop(device.logical_instance, None)
         device.logical_instance = instance_num
-        self._identity_by_instance[instance_num] = device.identity
+        self._device_by_instance[instance_num] = device
+        self._plan_order = None
         return device
 
+    def _set_device_id(self, device: Ace2BusDevice, device_id: int | None) -> None:
+        if device.device_id == device_id:
+            return
+        if device.device_id is not None and self._device_by_id.get(device.device_id) is device:
+            del self._device_by_id[device.device_id]
+        device.device_id = device_id
+        if device_id is not None:
+            holder = self._device_by_id.get(device_id)
+            if holder is not None:
+                holder.device_id = None
+            self._device_by_id[device_id] = device
+
     def assign_device_id(self, uid1: int, uid2: int, uid3: int, device_id: int) -> Ace2BusDevice:
         """Store the assigned bus device id for a discovered ACE2 unit."""
         device = self.record_discovered_device(uid1, uid2, uid3)
-        device.device_id = device_id
+        self._set_device_id(device, device_id)
         return device
 
+    def clear_device_id(self, device: Ace2BusDevice) -> None:
+        """Forget the device id of a unit that is no longer addressable."""
+        self._set_device_id(device, None)
+
     def bind_persisted_instances(self, mapping: Dict[int, Tuple[int, int, int]]) -> None:
         """Restore logical-instance bindings from persisted UID mappings."""
         for instance_num, uid_tuple in sorted(mapping.items()):
@@ -77,43 +127,341 @@ class Ace2BusSession:
     def export_bindings(self) -> Dict[int, Tuple[int, int, int]]:
         """Export current logical-instance bindings as a serialisable mapping."""
         return {
-            instance_num: identity.uid_tuple
-            for instance_num, identity in sorted(self._identity_by_instance.items())
+            instance_num: device.identity.uid_tuple
+            for instance_num, device in sorted(self._device_by_instance.items())
+        }
+
+    def export_device_ids(self) -> Dict[int, int]:
+        """Export the device id held by each bound logical instance."""
+        return {
+            instance_num: device.device_id
+            for instance_num, device in sorted(self._device_by_instance.items())
+            if device.device_id is not None
         }
 
     def get_device_for_instance(self, instance_num: int) -> Ace2BusDevice | None:
         """Return the bus device bound to a logical ACE instance."""
-        identity = self._identity_by_instance.get(instance_num)
-        if identity is None:
-            return None
-        return self._devices_by_identity.get(identity)
+        return self._device_by_instance.get(instance_num)
 
     def get_device_for_device_id(self, device_id: int) -> Ace2BusDevice | None:
         """Return the discovered ACE2 device currently using one bus device id."""
-        for device in self._devices_by_identity.values():
-            if device.device_id == device_id:
-                return device
-        return None
+        return self._device_by_id.get(device_id)
 
     def iter_discovered_devices(self) -> Iterable[Ace2BusDevice]:
         """Yield discovered devices in deterministic UID order."""
-        for identity in sorted(self._devices_by_identity, key=lambda item: item.uid_tuple):
-            yield self._devices_by_identity[identity]
-
-    def build_assignment_plan(self, start_device_id: int = 1) -> List[Ace2BusDevice]:
-        """Assign device IDs to known devices lacking one, preferring bound instances first."""
-        ordered_devices = sorted(
-            self._devices_by_identity.values(),
-            key=lambda device: (
-                device.logical_instance is None,
-                device.logical_instance if device.logical_instance is not None else 9999,
-                device.identity.uid_tuple,
-            ),
-        )
+        if self._uid_order is None:
+            self._uid_order = sorted(
+                self._devices_by_identity.values(),
+                key=lambda device: device.identity.uid_tuple,
+            )
+        return iter(self._uid_order)
+
+    def build_assignment_plan(
+            self,
+            start_device_id: int = 1,
+            present: Container[Ace2DeviceIdentity] | None = None) -> List[Ace2BusDevice]:
+        """
+        Assign device IDs to known devices lacking one, preferring bound instances first.
+
+        With ``present``, only those devices are planned (and returned); ids
+        already held by any known device are skipped.
+        """
+        if self._plan_order is None:
+            self._plan_order = sorted(
+                self._devices_by_identity.values(),
+                key=lambda device: (
+                    device.logical_instance is None,
+                    device.logical_instance if device.logical_instance is not None else 9999,
+                    device.identity.uid_tuple,
+                ),
+            )
+        ordered_devices = [
+            device for device in self._plan_order
+            if present is None or device.identity in present
+        ]
 
         next_device_id = start_device_id
         for device in ordered_devices:
             if device.device_id is None:
-                device.device_id = next_device_id
+                while next_device_id in self._device_by_id:
+                    next_device_id += 1
+                self._set_device_id(device, next_device_id)
                 next_device_id += 1
         return ordered_devices
+
+
+class Ace2BusBringUp:
+    """
+    Discover and address the units on one ACE2 bus without blocking the reactor.
+
+    When device ids from an earlier session are known (``persisted_ids``),
+    bring-up first verifies them: one targeted GET_INFO per persisted id, all
+    sent back-to-back. A unit that answers from its id without flagging
+    ``first_request`` kept power and its address since it was assigned, so it
+    is marked ready again without discovery or reassignment. GET_INFO carries
+    no UID; the binding is trusted because ids are only ever handed out by
+    UID from this host. If every instance verifies, bring-up ends after that
+    single round trip.
+
+    Otherwise discovery sends DISCOVER_DEVICE requests back-to-back and waits
+    for the whole round; each answer names one unit by UID. The first round
+    asks for every expected unit, since DISCOVER is a broadcast that verified
+    units may answer too. Another round, for the missing count only, follows
+    while units are missing and the round made progress, reported a collision
+    (ANTICOLLISION code or an all-zero UID), or nothing has been found yet -
+    at most MAX_DISCOVERY_ROUNDS. A round that only timed out or repeated
+    known UIDs ends discovery: the remaining units are absent.
+
+    Assignment then binds unbound logical instances to discovered units in
+    UID order and sends ASSIGN_DEVICE_ID back-to-back for every discovered
+    unit that was not verified, avoiding ids still held by verified units.
+    Units that answered with an error or not at all are retried together in
+    the next round, up to MAX_ASSIGN_ROUNDS; a unit still failing after that
+    is reported and left without a device id.
+
+    Each phase therefore costs one bus round trip however many units there
+    are, unless collisions force a retry. ``stats`` records the phase
+    durations, rounds, collisions and retries; ``on_done(bringup)`` runs once
+    after the last round. Responses arriving after cancel() are ignored.
+    """
+
+    MAX_DISCOVERY_ROUNDS = 3
+    MAX_ASSIGN_ROUNDS = 3
+    ANTICOLLISION_CODE = 4
+
+    def __init__(
+            self,
+            session: Ace2BusSession,
+            protocol,
+            send: Callable[[dict, Callable], None],
+            instance_nums: List[int],
+            on_done: Callable[["Ace2BusBringUp"], None],
+            clock: Callable[[], float],
+            log: Callable[[str], None],
+            persisted_ids: Dict[int, int] | None = None) -> None:
+        self.session = session
+        self.protocol = protocol
+        self._send = send
+        self.instance_nums = sorted(instance_nums)
+        self._on_done = on_done
+        self._clock = clock
+        self._log = log
+        self.persisted_ids = dict(persisted_ids or {})
+        self.state = "idle"
+        self.failed_assignments: List[Ace2BusDevice] = []
+        # UIDs this bring-up heard from; persisted bindings alone don't count
+        self._seen: set = set()
+        self._verified: set = set()
+        self._outstanding = 0
+        self._round_new = 0
+        self._round_collisions = 0
+        self._round_failed: List[Tuple[Ace2BusDevice, Any]] = []
+        self._started_at = 0.0
+        self._phase_started_at = 0.0
+        self.stats: Dict[str, Any] = {
+            "units_expected": len(self.instance_nums),
+            "verified": 0,
+            "discovered": 0,
+            "assigned": 0,
+            "discovery_rounds": 0,
+            "assign_rounds": 0,
+            "collisions": 0,
+            "duplicates": 0,
+            "timeouts": 0,
+            "retries": 0,
+            "verify_s": 0.0,
+            "discovery_s": 0.0,
+            "assignment_s": 0.0,
+            "total_s": 0.0,
+        }
+
+    @property
+    def done(self) -> bool:
+        return self.state in ("done", "cancelled")
+
+    @property
+    def found_count(self) -> int:
+        """Units present on the bus: verified by id or answering discovery."""
+        return len(self._seen | self._verified)
+
+    def start(self) -> None:
+        self._started_at = self._phase_started_at = self._clock()
+        candidates = []
+        for instance_num in self.instance_nums:
+            device = self.session.get_device_for_instance(instance_num)
+            device_id = self.persisted_ids.get(instance_num)
+            if device is not None and device_id:
+                candidates.append((device, device_id))
+        if candidates:
+            self._verify_round(candidates)
+        else:
+            self._start_discovery()
+
+    def cancel(self) -> None:
+        if not self.done:
+            self.state = "cancelled"
+
+    # ---- verification of persisted device ids ----
+
+    def _verify_round(self, candidates: List[Tuple[Ace2BusDevice, int]]) -> None:
+        self.state = "verifying"
+        self._outstanding = len(candidates)
+        for device, device_id in candidates:
+            request = self.protocol.build_get_info_request()
+            request["target_device_id"] = device_id
+            self._send(
+                request,
+                lambda response=None, device=device, device_id=device_id: self._on_verify(
+                    device, device_id, response
+                ),
+            )
+
+    def _on_verify(self, device: Ace2BusDevice, device_id: int, response) -> None:
+        if self.state != "verifying":
+            return
+        if not response:
+            self.stats["timeouts"] += 1
+        elif (
+            response.get("device_id") == device_id
+            and response.get("code", 0) == 0
+            and not (response.get("result") or {}).get("first_request")
+        ):
+            self.session.assign_device_id(*device.identity.uid_tuple, device_id)
+            self._verified.add(device.identity)
+        self._outstanding -= 1
+        if self._outstanding == 0:
+            now = self._clock()
+            self.stats["verified"] = len(self._verified)
+            self.stats["verify_s"] = now - self._phase_started_at
+            self._phase_started_at = now
+            if len(self._verified) >= len(self.instance_nums):
+                self._finish()
+            else:
+                self._start_discovery()
+
+    # ---- discovery ----
+
+    def _start_discovery(self) -> None:
+        self.state = "discovering"
+        self._discovery_round(len(self.instance_nums))
+
+    def _discovery_round(self, count: int) -> None:
+        self.stats["discovery_rounds"] += 1
+        if self.stats["discovery_rounds"] > 1:
+            self.stats["retries"] += count
+        self._round_new = 0
+        self._round_collisions = 0
+        self._outstanding = count
+        round_id = self.stats["discovery_rounds"]
+        for _ in range(count):
+            self._send(
+                self.protocol.build_discover_device_request(),
+                lambda response=None, round_id=round_id: self._on_discover(round_id, response),
+            )
+
+    def _on_discover(self, round_id: int, response) -> None:
+        if self.state != "discovering" or round_id != self.stats["discovery_rounds"]:
+            return
+        if not response or "result" not in response:
+            self.stats["timeouts"] += 1
+        else:
+            result = response["result"]
+            uid = (result.get("uid1", 0), result.get("uid2", 0), result.get("uid3", 0))
+            if response.get("code") == self.ANTICOLLISION_CODE or uid == (0, 0, 0):
+                self._round_collisions += 1
+                self.stats["collisions"] += 1
+            else:
+                device = self.session.record_discovered_device(*uid)
+                if device.identity in self._seen or device.identity in self._verified:
+                    self.stats["duplicates"] += 1
+                else:
+                    self._seen.add(device.identity)
+                    self._round_new += 1
+        self._outstanding -= 1
+        if self._outstanding == 0:
+            self._end_discovery_round()
+
+    def _end_discovery_round(self) -> None:
+        found = self.found_count
+        missing = len(self.instance_nums) - found
+        if (
+            missing > 0
+            and self.stats["discovery_rounds"] < self.MAX_DISCOVERY_ROUNDS
+            and (self._round_new or self._round_collisions or not found)
+        ):
+            self._discovery_round(missing)
+            return
+        now = self._clock()
+        self.stats["discovered"] = len(self._seen)
+        self.stats["discovery_s"] = now - self._phase_started_at
+        if not found:
+            self._finish()
+            return
+        self._phase_started_at = now
+        self._start_assignment()
+
+    # ---- assignment ----
+
+    def _start_assignment(self) -> None:
+        self.state = "assigning"
+        for instance_num, device in zip(self.instance_nums, list(self.session.iter_discovered_devices())):
+            if device.logical_instance is None:
+                self.session.bind_logical_instance(instance_num, *device.identity.uid_tuple)
+        plan = self.session.build_assignment_plan(
+            start_device_id=1,
+            present=self._seen - self._verified,
+        )
+        self._assign_round(plan)
+
+    def _assign_round(self, devices: List[Ace2BusDevice]) -> None:
+        self.stats["assign_rounds"] += 1
+        if self.stats["assign_rounds"] > 1:
+            self.stats["retries"] += len(devices)
+        self._round_failed = []
+        self._outstanding = len(devices)
+        if not devices:
+            self._end_assign_round()
+            return
+        round_id = self.stats["assign_rounds"]
+        for device in devices:
+            self._send(
+                self.protocol.build_assign_device_id_request(*device.identity.uid_tuple, device.device_id),
+                lambda response=None, device=device, round_id=round_id: self._on_assign(round_id, device, response),
+            )
+
+    def _on_assign(self, round_id: int, device: Ace2BusDevice, response) -> None:
+        if self.state != "assigning" or round_id != self.stats["assign_rounds"]:
+            return
+        if not response:
+            self.stats["timeouts"] += 1
+            self._round_failed.append((device, response))
+        elif response.get("code") != 0:
+            if response.get("code") == self.ANTICOLLISION_CODE:
+                self.stats["collisions"] += 1
+            self._round_failed.append((device, response))
+        else:
+            self.stats["assigned"] += 1
+        self._outstanding -= 1
+        if self._outstanding == 0:
+            self._end_assign_round()
+
+    def _end_assign_round(self) -> None:
+        failed = self._round_failed
+        if failed and self.stats["assign_rounds"] < self.MAX_ASSIGN_ROUNDS:
+            self._assign_round([device for device, _ in failed])
+            return
+        for device, response in failed:
+            # Not addressable: keep the instance out of runtime polling
+            self.session.clear_device_id(device)
+            self.failed_assignments.append(device)
+            self._log(
+                f"ACE2 device-id assignment failed for UID={device.identity.uid_tuple}: {response}"
+            )
+        self.stats["assignment_s"] = self._clock() - self._phase_started_at
+        self._finish()
+
+    def _finish(self) -> None:
+        self.state = "done"
+        self.stats["total_s"] = self._clock() - self._started_at
+        self.session.last_bringup = dict(self.stats)
+        self._on_done(self)
@@ -551,7 +551,165 @@ def cmd_ACE_GET_CONNECTION_STATUS(gcmd):
                 stability_status = f"disconnected ({reconnects}/{threshold} reconnects)"
 
             lines.append(
-                f"  └─ Layer 3 - Manager: {stability_status}"
+                f"  ├─ Layer 3 - Manager: {stability_status}"
+            )
+
+            # Request timeouts: per-command values derived from measured round trips
+            timeouts = status.get("timeouts", {})
+            per_command = timeouts.get("commands", {})
+            if timeouts.get("adaptive") and per_command:
+                timeout_desc = ", ".join(
+                    f"{name}={stats.get('timeout_s', 0.0):.2f}s "
+                    f"(rtt {stats.get('srtt', 0.0) * 1000:.0f}ms, n={stats.get('samples', 0)})"
+                    for name, stats in sorted(per_command.items())
+                )
+                lines.append(f"  ├─ Timeouts: adaptive - {timeout_desc}")
+            elif timeouts:
+                mode = "adaptive" if timeouts.get("adaptive") else "fixed"
+                lines.append(
+                    f"  ├─ Timeouts: {mode} - default {timeouts.get('default_s', 0.0):.1f}s"
+                )
+
+            # Request frame templates: how many frames skipped JSON encoding
+            frame_cache = status.get("frame_cache")
+            if frame_cache:
+                hits = frame_cache.get("hits", 0)
+                lookups = hits + frame_cache.get("misses", 0) + frame_cache.get("uncacheable", 0)
+                hit_rate = (100.0 * hits / lookups) if lookups else 0.0
+                lines.append(
+                    f"  ├─ Frame cache: {hit_rate:.0f}% hit - {hits} hits, "
+                    f"{frame_cache.get('misses', 0)} misses, "
+                    f"{frame_cache.get('uncacheable', 0)} uncacheable"
+                )
+
+            # Duplicate status/info reads answered by an already queued request
+            if "coalesced_requests" in status:
+                lines.append(f"  ├─ Coalesced reads: {status['coalesced_requests']}")
+
+            # Scheduler: how long requests waited for a window slot
+            sched = status.get("queue")
+            if sched:
+                high = sched.get("high", {})
+                normal = sched.get("normal", {})
+                stale = high.get("dropped_stale", 0) + normal.get("dropped_stale", 0)
+                lines.append(
+                    f"  ├─ Queue: {sched.get('depth', 0)} waiting (peak {sched.get('peak_depth', 0)}) - "
+                    f"wait high {high.get('avg_wait_s', 0.0) * 1000:.0f}/"
+                    f"{high.get('max_wait_s', 0.0) * 1000:.0f}ms, "
+                    f"normal {normal.get('avg_wait_s', 0.0) * 1000:.0f}/"
+                    f"{normal.get('max_wait_s', 0.0) * 1000:.0f}ms avg/max, "
+                    f"{stale} stale dropped"
+                )
+                # Shared ACE2 bus: per-device share of the window
+                devices = {k: v for k, v in sched.get("flows", {}).items() if k is not None}
+                if devices:
+                    device_desc = ", ".join(
+                        f"#{device_id} {flow.get('queued', 0)} queued/"
+                        f"{flow.get('inflight', 0)} in flight/{flow.get('dispatched', 0)} sent"
+                        for device_id, flow in sorted(devices.items())
+                    )
+                    lines.append(f"  ├─ Bus devices: {device_desc}")
+
+            # Wire pacing: byte budget protecting the ACE input buffer
+            pacing = status.get("pacing")
+            if pacing:
+                if pacing.get("enabled"):
+                    lines.append(
+                        f"  ├─ Pacing: {pacing.get('burst_bytes', 0)}B @ "
+                        f"{pacing.get('rate_bytes_s', 0.0):.0f}B/s - "
+                        f"{pacing.get('paced_frames', 0)} of {pacing.get('frames_sent', 0)} frames held "
+                        f"(max {pacing.get('max_delay_s', 0.0) * 1000:.0f}ms)"
+                    )
+                else:
+                    lines.append(f"  ├─ Pacing: off - {pacing.get('frames_sent', 0)} frames")
+
+            # Link metrics: latency per command (drift = recent vs avg), traffic, errors
+            metrics = status.get("metrics")
+            if metrics:
+                for command, rtt in metrics.get("rtt", {}).items():
+                    lines.append(
+                        f"  ├─ Latency {command}: p50 {rtt.get('p50_ms') or 0:.0f}ms "
+                        f"p95 {rtt.get('p95_ms') or 0:.0f}ms - avg {rtt.get('avg_ms', 0.0):.1f}ms, "
+                        f"recent {rtt.get('recent_ms', 0.0):.1f}ms, max {rtt.get('max_ms', 0.0):.0f}ms "
+                        f"(n={rtt.get('count', 0)}, timeouts={metrics.get('timeouts', {}).get(command, 0)})"
+                    )
+                tx = metrics.get("tx", {})
+                rx = metrics.get("rx", {})
+                window = metrics.get("window", {})
+                errors = metrics.get("errors", {})
+                lines.append(
+                    f"  ├─ Traffic: tx {tx.get('frames', 0)} frames/{tx.get('bytes', 0)}B, "
+                    f"rx {rx.get('frames', 0)} frames/{rx.get('bytes', 0)}B - window avg "
+                    f"{window.get('avg', 0.0):.2f}/{window.get('size', 0)} (peak {window.get('peak', 0)}), "
+                    f"queue wait p95 {metrics.get('queue_wait', {}).get('p95_ms') or 0:.0f}ms"
+                )
+                decode = metrics.get("decode", {})
+                lines.append(
+                    f"  ├─ Frame errors: {errors.get('crc', 0)} CRC, {errors.get('resync', 0)} resync, "
+                    f"{errors.get('decode', 0)} decode, {errors.get('other', 0)} other - "
+                    f"decode avg {decode.get('avg_us', 0.0):.0f}us, max {decode.get('max_us', 0.0):.0f}us "
+                    f"(n={decode.get('frames', 0)})"
+                )
+
+            # Shared ACE2 bus: how the last discovery/assignment went
+            bringup = getattr(getattr(ace, "bus_session", None), "last_bringup", None)
+            if isinstance(bringup, dict):
+                lines.append(
+                    f"  ├─ Bus bring-up: {bringup.get('verified', 0)} verified + {bringup.get('assigned', 0)} "
+                    f"assigned of {bringup.get('units_expected', 0)} in {bringup.get('total_s', 0.0) * 1000:.0f}ms - "
+                    f"verify {bringup.get('verify_s', 0.0) * 1000:.0f}ms, discovery "
+                    f"{bringup.get('discovery_s', 0.0) * 1000:.0f}ms/{bringup.get('discovery_rounds', 0)} round(s), "
+                    f"assignment {bringup.get('assignment_s', 0.0) * 1000:.0f}ms/"
+                    f"{bringup.get('assign_rounds', 0)} round(s), {bringup.get('collisions', 0)} collisions, "
+                    f"{bringup.get('retries', 0)} retries, {bringup.get('timeouts', 0)} timeouts"
+                )
+
+            # Heartbeat: current status poll cadence and how often each was used
+            heartbeat = status.get("heartbeat")
+            if heartbeat:
+                polls = heartbeat.get("polls", {})
+                if heartbeat.get("adaptive"):
+                    lines.append(
+                        f"  ├─ Heartbeat: {heartbeat.get('mode', 'unknown')} - "
+                        f"{heartbeat.get('busy_interval', 0.0):.2f}/"
+                        f"{heartbeat.get('base_interval', 0.0):.1f}/"
+                        f"{heartbeat.get('idle_interval', 0.0):.1f}s busy/active/idle, polls "
+                        f"{polls.get('busy', 0)}/{polls.get('active', 0)}/{polls.get('idle', 0)}"
+                    )
+                else:
+                    lines.append(
+                        f"  ├─ Heartbeat: fixed {heartbeat.get('base_interval', 0.0):.1f}s"
+                    )
+
+            # Hot-plug: device events and how long the last reconnect took
+            hotplug = status.get("hotplug")
+            if hotplug:
+                last = hotplug.get("last_reconnect_s")
+                last_desc = (
+                    f"last reconnect {last:.1f}s ({hotplug.get('last_reconnect_trigger')})"
+                    if last is not None else "no reconnects"
+                )
+                lines.append(
+                    f"  ├─ Hot-plug: {'on' if hotplug.get('enabled') else 'off'} - "
+                    f"{hotplug.get('events', 0)} device events, {last_desc}"
+                )
+
+            # Ports: shared enumeration cache (scans vs. cached lookups)
+            inventory = status.get("port_inventory")
+            if inventory:
+                last = inventory.get("last_invalidation")
+                lines.append(
+                    f"  ├─ Ports: {inventory.get('scans', 0)} scans, "
+                    f"{inventory.get('hits', 0)} cached lookups, "
+                    f"{inventory.get('invalidations', 0)} invalidations"
+                    + (f" (last: {last})" if last else "")
+                )
+
+            # Reader: how the serial port is serviced and how often it woke up idle
+            reader = status.get("reader", {})
+            lines.append(
+                f"  └─ Reader: {reader.get('mode', 'unknown')} - "
+                f"{reader.get('wakeups', 0)} wakeups, {reader.get('empty_wakeups', 0)} empty"
             )
 
         gcmd.respond_info("\n".join(lines))
@@ -2127,6 +2285,15 @@ def cmd_ACE_SHOW_INSTANCE_CONFIG(gcmd):
         gcmd.respond_info(f"ACE_SHOW_INSTANCE_CONFIG error: {e}")
 
 
+def cmd_ACE_STARTUP_REPORT(gcmd):
+    """Show per-unit startup phase timings measured from klippy:ready."""
+    try:
+        manager = ace_get_manager(0)
+        gcmd.respond_info("\n".join(manager.startup_timeline.format_report()))
+    except Exception as e:
+        gcmd.respond_info(f"ACE_STARTUP_REPORT error: {e}")
+
+
 def cmd_ACE_FLUSH(gcmd):
     """Persist any pending variable changes to disk immediately."""
     manager = ace_get_manager(0)
@@ -2141,6 +2308,8 @@ ACE_COMMANDS = [
     ("ACE_GET_STATUS", cmd_ACE_GET_STATUS, "Query ACE status. INSTANCE= or TOOL=, VERBOSE=1 for detailed output"),
     ("ACE_GET_CONNECTION_STATUS", cmd_ACE_GET_CONNECTION_STATUS,
      "Get connection status for all ACE instances (connected, stable, retry info)"),
+    ("ACE_STARTUP_REPORT", cmd_ACE_STARTUP_REPORT,
+     "Show startup timing per ACE unit (probe, open, info, status, rfid) since klippy:ready"),
     ("ACE_RECONNECT", cmd_ACE_RECONNECT, "Reconnect ACE serial. INSTANCE= DELAY=5"),
     ("ACE_GET_CURRENT_INDEX", cmd_ACE_GET_CURRENT_INDEX, "Query currently loaded tool index"),
     ("ACE_FEED", cmd_ACE_FEED, "Feed filament. T=<tool> or INSTANCE= INDEX=, LENGTH=, [SPEED=]"),
@@ -5,6 +5,7 @@ Holds shared constants, configuration loading, and utility functions
 that don't depend on specific instances.
 """
 
+import logging
 import re
 from enum import Enum
 
@@ -156,6 +157,54 @@ def read_ace_config(config):
     ace_config["ace_connection_supervision"] = config.getboolean(
         "ace_connection_supervision", True
     )
+    # Derive request timeouts from measured round-trip times per command.
+    # When False every request uses the fixed 5 s transport timeout.
+    ace_config["adaptive_request_timeouts"] = config.getboolean(
+        "adaptive_request_timeouts", True
+    )
+    # Serial reader: "fd" wakes the reactor when the port has data,
+    # "timer" polls the port every 50 ms (legacy behaviour), "thread" moves
+    # blocking reads/writes and frame parsing to a per-transport I/O thread.
+    ace_config["serial_reader_mode"] = config.get(
+        "serial_reader_mode", "fd"
+    ).strip().lower()
+    if ace_config["serial_reader_mode"] not in ("fd", "timer", "thread"):
+        logging.warning(
+            f"ACE: Invalid serial_reader_mode '{ace_config['serial_reader_mode']}' "
+            f"(expected fd, timer or thread), using fd"
+        )
+        ace_config["serial_reader_mode"] = "fd"
+    # Watch /dev for the ACE reappearing after a USB drop and reconnect at
+    # once instead of waiting for the retry backoff (Linux inotify).
+    ace_config["hotplug_detection"] = config.getboolean("hotplug_detection", True)
+    # Outgoing byte budget (token bucket) protecting the ACE's ~1 KiB input
+    # buffer. Off by default: "auto" and 0 leave writes unpaced; a positive
+    # tx_rate_limit (bytes/s) enables pacing with a tx_burst_bytes bucket.
+    ace_config["tx_rate_limit"] = _parse_auto_number(
+        config.get("tx_rate_limit", "auto"), "tx_rate_limit", float
+    )
+    ace_config["tx_burst_bytes"] = _parse_auto_number(
+        config.get("tx_burst_bytes", "auto"), "tx_burst_bytes", int
+    )
+    # Heartbeat cadence: poll fast while a unit is busy or waited on, slow
+    # down when idle (not printing, dryer off, no commands for idle_after).
+    # heartbeat_interval stays the normal rate. False polls at a fixed rate.
+    ace_config["adaptive_heartbeat"] = config.getboolean("adaptive_heartbeat", True)
+    ace_config["heartbeat_busy_interval"] = config.getfloat(
+        "heartbeat_busy_interval", 0.15
+    )
+    ace_config["heartbeat_idle_interval"] = config.getfloat(
+        "heartbeat_idle_interval", 5.0
+    )
+    ace_config["heartbeat_idle_after"] = config.getfloat(
+        "heartbeat_idle_after", 300.0
+    )
+    # Opt-in capture of raw serial traffic for offline replay
+    # (tools/ace_wire_replay.py). Empty disables; files rotate at
+    # wire_log_max_kb keeping wire_log_backups older files per transport.
+    ace_config["wire_log_dir"] = config.get("wire_log_dir", "")
+    ace_config["wire_log_max_kb"] = config.getint("wire_log_max_kb", 1024)
+    ace_config["wire_log_backups"] = config.getint("wire_log_backups", 2)
     # Orca filament sync via Moonraker database namespace "lane_data"
     # Enabled by default to keep Orca lane data up to date. Set to False to opt-out
     # of Moonraker writes.
@@ -517,6 +566,26 @@ def parse_instance_baud_config(config_value, instance_num, protocol_name):
         raise ValueError(f"Invalid config value for baud: '{raw_value}'") from exc
 
 
+def _parse_auto_number(raw_value, name, cast):
+    """
+    Parse a non-negative numeric option that also accepts "auto".
+
+    Returns None for "auto" and, like serial_reader_mode, warns and falls
+    back to auto for invalid values.
+    """
+    text = str(raw_value).strip().lower()
+    if text in ("", "auto"):
+        return None
+    try:
+        value = cast(text)
+    except ValueError:
+        value = -1
+    if value < 0:
+        logging.warning(f"ACE: Invalid {name} '{raw_value}', using protocol default")
+        return None
+    return value
+
+
 OVERRIDABLE_PARAMS = [
     "feed_speed",
     "retract_speed",
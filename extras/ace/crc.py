@@ -0,0 +1,75 @@
+"""CRC-16/MCRF4XX used by ACE1 and ACE2 framing.
+
+Parameters: poly 0x1021 (reflected 0x8408), init 0xFFFF, reflected in/out,
+no final XOR. Three implementations with identical results:
+
+- ``crc16_mcrf4xx_reference``: the original per-byte shift loop
+- ``crc16_mcrf4xx_table``: 256-entry table, one lookup per byte
+- ``crc16_mcrf4xx_fast``: ``binascii.crc_hqx`` (C) on bit-reversed input
+
+``crc16_mcrf4xx`` is bound to the fastest available implementation.
+"""
+
+from __future__ import annotations
+
+try:
+    import binascii
+    _crc_hqx = binascii.crc_hqx
+except (ImportError, AttributeError):  # pragma: no cover - CPython always has it
+    _crc_hqx = None
+
+
+def crc16_mcrf4xx_reference(buffer) -> int:
+    """Per-byte shift implementation kept as the bit-exact reference."""
+    crc = 0xFFFF
+    for byte in buffer:
+        data = byte
+        data ^= crc & 0xFF
+        data ^= (data & 0x0F) << 4
+        crc = ((data << 8) | (crc >> 8)) ^ (data >> 4) ^ (data << 3)
+    return crc
+
+
+def _build_table() -> tuple:
+    table = []
+    for value in range(256):
+        crc = value
+        for _ in range(8):
+            crc = (crc >> 1) ^ 0x8408 if crc & 1 else crc >> 1
+        table.append(crc)
+    return tuple(table)
+
+
+CRC16_MCRF4XX_TABLE = _build_table()
+
+
+def crc16_mcrf4xx_table(buffer) -> int:
+    """Table-driven implementation (pure Python)."""
+    table = CRC16_MCRF4XX_TABLE
+    crc = 0xFFFF
+    for byte in buffer:
+        crc = (crc >> 8) ^ table[(crc ^ byte) & 0xFF]
+    return crc
+
+
+# MCRF4XX is the bit-reflected form of CRC-CCITT. Reversing every input byte,
+# running the non-reflected CCITT CRC (binascii.crc_hqx) and reversing the
+# 16-bit result gives the same value; init 0xFFFF is its own reversal.
+_REVERSE_BITS8 = bytes(int(f"{value:08b}"[::-1], 2) for value in range(256))
+
+
+def _reverse16(value: int) -> int:
+    return (_REVERSE_BITS8[value & 0xFF] << 8) | _REVERSE_BITS8[value >> 8]
+
+
+def crc16_mcrf4xx_fast(buffer) -> int:
+    """C-accelerated implementation via binascii.crc_hqx."""
+    return _reverse16(_crc_hqx(bytes(buffer).translate(_REVERSE_BITS8), 0xFFFF))
+
+
+if _crc_hqx is not None:
+    crc16_mcrf4xx = crc16_mcrf4xx_fast
+    CRC16_BACKEND = "binascii"
+else:  # pragma: no cover
+    crc16_mcrf4xx = crc16_mcrf4xx_table
+    CRC16_BACKEND = "table"
@@ -0,0 +1,129 @@
+"""Heartbeat (status poll) cadence driven by device activity."""
+
+from __future__ import annotations
+
+from typing import Any, Dict, Optional
+
+
+class AceHeartbeatPolicy:
+    """
+    Choose the interval until the next status poll of one ACE unit.
+
+    Three cadences:
+
+    - busy: ``busy_interval`` while the unit reports busy or something
+      (wait_ready) is blocked on its next status
+    - active: ``base_interval`` (heartbeat_interval) by default, while
+      printing, while the dryer runs and for ``idle_after`` seconds after
+      the last command
+    - idle: ``idle_interval`` once none of the above has been true for
+      ``idle_after`` seconds
+
+    note_command() ends idle mode at once; the caller then pulls the next
+    poll forward with soonest_interval(). With ``adaptive`` False every
+    poll uses ``base_interval``.
+    """
+
+    def __init__(
+            self,
+            base_interval: float = 1.0,
+            busy_interval: float = 0.15,
+            idle_interval: float = 5.0,
+            idle_after: float = 300.0,
+            adaptive: bool = True):
+        self.base_interval = max(0.05, float(base_interval))
+        self.busy_interval = min(self.base_interval, max(0.05, float(busy_interval)))
+        self.idle_interval = max(self.base_interval, float(idle_interval))
+        self.idle_after = max(0.0, float(idle_after))
+        self.adaptive = bool(adaptive)
+        self.device_busy = False
+        self.dryer_active = False
+        self.printing = False
+        self.waiters = 0
+        self._last_activity: Optional[float] = None
+        self.polls = {"busy": 0, "active": 0, "idle": 0}
+
+    def note_command(self, now: float) -> None:
+        """A command other than a status poll was queued for the unit."""
+        self._last_activity = now
+
+    def note_status(
+            self,
+            result: Dict[str, Any],
+            now: float,
+            printing: bool = False,
+            busy_is_idle: bool = False) -> None:
+        """
+        Update device state from a status result.
+
+        ``busy_is_idle`` is set by callers whose device reports busy for a
+        steady state (ACE2 while feed assist runs), so it does not keep the
+        poll rate up for a whole print.
+        """
+        if not isinstance(result, dict):
+            return
+        status = result.get("status")
+        action = result.get("action") or "none"
+        dryer = result.get("dryer_status") or {}
+        self.device_busy = (
+            (status == "busy" and not busy_is_idle) or action not in ("none", "")
+        )
+        self.dryer_active = dryer.get("status", "stop") not in ("stop", "unknown")
+        self.printing = bool(printing)
+        if self._last_activity is None or self.device_busy or self.dryer_active or self.printing:
+            self._last_activity = now
+
+    def begin_wait(self, now: float) -> None:
+        """An operation started waiting on the unit's next status."""
+        self.waiters += 1
+        self._last_activity = now
+
+    def end_wait(self, now: float) -> None:
+        """The operation from begin_wait() finished (or gave up)."""
+        self.waiters = max(0, self.waiters - 1)
+        self._last_activity = now
+
+    def mode(self, now: float) -> str:
+        """Current cadence: "busy", "active" or "idle"."""
+        if not self.adaptive:
+            return "active"
+        if self.waiters or self.device_busy:
+            return "busy"
+        if self.printing or self.dryer_active:
+            return "active"
+        if self._last_activity is None:
+            self._last_activity = now
+        if now - self._last_activity < self.idle_after:
+            return "active"
+        return "idle"
+
+    def interval(self, now: float) -> float:
+        """Seconds until the next poll; counts the poll for snapshot()."""
+        self.polls[self.mode(now)] += 1
+        return self.current_interval(now)
+
+    def current_interval(self, now: float) -> float:
+        """Cadence of the current mode, without counting a poll."""
+        mode = self.mode(now)
+        if mode == "busy":
+            return self.busy_interval
+        if mode == "idle":
+            return self.idle_interval
+        return self.base_interval
+
+    def soonest_interval(self) -> float:
+        """Delay for a poll pulled forward by a command or a waiter."""
+        return self.busy_interval if self.adaptive else self.base_interval
+
+    def snapshot(self, now: float) -> Dict[str, Any]:
+        """Return cadence configuration, state and poll counts."""
+        return {
+            "adaptive": self.adaptive,
+            "mode": self.mode(now),
+            "base_interval": self.base_interval,
+            "busy_interval": self.busy_interval,
+            "idle_interval": self.idle_interval,
+            "idle_after": self.idle_after,
+            "waiters": self.waiters,
+            "polls": dict(self.polls),
+        }
@@ -0,0 +1,148 @@
+"""Serial device hot-plug notifications via Linux inotify."""
+
+from __future__ import annotations
+
+import ctypes
+import ctypes.util
+import logging
+import os
+import struct
+from typing import Callable, Iterable, List, Optional, Tuple
+
+IN_MOVED_TO = 0x00000080
+IN_CREATE = 0x00000100
+IN_NONBLOCK = os.O_NONBLOCK
+IN_CLOEXEC = getattr(os, "O_CLOEXEC", 0o2000000)
+
+_EVENT_HEADER = struct.Struct("iIII")  # wd, mask, cookie, name length
+
+DEFAULT_WATCH_DIRS = (
+    # Stable per-USB-port symlinks created by udev once the device settles
+    ("/dev/serial/by-path", ""),
+    # Raw device nodes; present even when by-path does not exist yet
+    ("/dev", "tty"),
+)
+
+
+def _load_libc():
+    try:
+        libc = ctypes.CDLL(ctypes.util.find_library("c") or "libc.so.6", use_errno=True)
+        libc.inotify_init1
+        libc.inotify_add_watch
+    except (OSError, AttributeError):
+        return None
+    return libc
+
+
+class AceHotplugWatcher:
+    """
+    Report serial device nodes appearing under /dev.
+
+    Uses one non-blocking inotify descriptor registered with the Klipper
+    reactor, so no thread or polling timer is needed. ``callback(path)`` is
+    called from the reactor for every new entry whose name starts with the
+    directory's prefix. start() returns False when inotify is unavailable
+    (non-Linux, restricted container); callers then rely on their retry
+    backoff alone.
+    """
+
+    MASK = IN_CREATE | IN_MOVED_TO
+    READ_SIZE = 4096
+
+    def __init__(self, reactor, callback: Callable[[str], None],
+                 watch_dirs: Iterable[Tuple[str, str]] = DEFAULT_WATCH_DIRS):
+        self.reactor = reactor
+        self.callback = callback
+        self.watch_dirs = list(watch_dirs)
+        self._fd: Optional[int] = None
+        self._fd_handle = None
+        self._watches = {}  # wd -> (directory, name prefix)
+        self.events = 0
+
+    @property
+    def active(self) -> bool:
+        return self._fd is not None
+
+    def start(self) -> bool:
+        """Open inotify and watch every existing directory; False if unavailable."""
+        if self._fd is not None:
+            return True
+        libc = _load_libc()
+        if libc is None:
+            return False
+        fd = libc.inotify_init1(IN_NONBLOCK | IN_CLOEXEC)
+        if fd < 0:
+            logging.info(f"ACE: inotify unavailable (errno {ctypes.get_errno()})")
+            return False
+
+        for directory, prefix in self.watch_dirs:
+            if not os.path.isdir(directory):
+                continue
+            wd = libc.inotify_add_watch(fd, os.fsencode(directory), self.MASK)
+            if wd >= 0:
+                self._watches[wd] = (directory, prefix)
+        if not self._watches:
+            os.close(fd)
+            return False
+
+        try:
+            self._fd_handle = self.reactor.register_fd(fd, self._handle_readable)
+        except Exception as e:
+            logging.info(f"ACE: Cannot register hot-plug watcher: {e}")
+            os.close(fd)
+            self._watches.clear()
+            return False
+        self._fd = fd
+        return True
+
+    def stop(self) -> None:
+        """Unregister from the reactor and close the inotify descriptor."""
+        if self._fd_handle is not None:
+            try:
+                self.reactor.unregister_fd(self._fd_handle)
+            except Exception:
+                pass
+            self._fd_handle = None
+        if self._fd is not None:
+            try:
+                os.close(self._fd)
+            except OSError:
+                pass
+            self._fd = None
+        self._watches.clear()
+
+    def _read_paths(self) -> List[str]:
+        paths = []
+        while self._fd is not None:
+            try:
+                data = os.read(self._fd, self.READ_SIZE)
+            except BlockingIOError:
+                break
+            except OSError as e:
+                logging.info(f"ACE: Hot-plug watcher read failed: {e}")
+                self.stop()
+                break
+            if not data:
+                break
+            offset = 0
+            while offset + _EVENT_HEADER.size <= len(data):
+                wd, _mask, _cookie, name_len = _EVENT_HEADER.unpack_from(data, offset)
+                offset += _EVENT_HEADER.size
+                name = data[offset:offset + name_len].split(b"\0", 1)[0]
+                offset += name_len
+                watch = self._watches.get(wd)
+                if watch is None or not name:
+                    continue
+                directory, prefix = watch
+                name = os.fsdecode(name)
+                if name.startswith(prefix):
+                    paths.append(os.path.join(directory, name))
+        return paths
+
+    def _handle_readable(self, eventtime):
+        for path in self._read_paths():
+            self.events += 1
+            try:
+                self.callback(path)
+            except Exception as e:
+                logging.warning(f"ACE: Hot-plug callback error for {path}: {e}")
@@ -24,7 +24,11 @@ from .config import (
     normalize_ace_slot_state,
 )
 from .protocol import create_protocol_adapter, normalize_protocol_name, resolve_protocol_name
+from .heartbeat_policy import AceHeartbeatPolicy
 from .serial_manager import AceSerialManager
+from .status_delta import AceStatusDelta
+from .transport_metrics import AceTransportMetrics
+from .wire_recorder import create_wire_recorder
 
 
 class AceInstance:
@@ -54,6 +58,13 @@ class AceInstance:
         "PC": 260,
     }
 
+    # Warm-start status snapshot (persisted as ace_status_snapshot_<n>)
+    STATUS_SNAPSHOT_VERSION = 1
+    STATUS_SNAPSHOT_SLOT_KEYS = ("index", "status", "sku", "type", "color", "rfid")
+    STATUS_SNAPSHOT_DEVICE_KEYS = (
+        "model", "firmware", "boot_firmware", "structure_version", "version", "boot_version",
+    )
+
     def __init__(
         self,
         instance_num,
@@ -64,6 +75,7 @@ class AceInstance:
         active_protocol_name=None,
         serial_mgr=None,
         bus_session=None,
+        port_inventory=None,
     ):
         """
         Initialize ACE instance.
@@ -73,6 +85,7 @@ class AceInstance:
             ace_config: Configuration dict
             printer: Klipper printer object
             ace_enabled: Initial ACE Pro enabled state
+            port_inventory: Serial port snapshot shared across instances
         """
         self.variables = {}
         self.SLOT_COUNT = SLOTS_PER_ACE
@@ -109,6 +122,13 @@ class AceInstance:
 
         self.toolhead = None
         self._info = create_status_dict(self.SLOT_COUNT)
+        self._status_stale = False  # _info restored from snapshot, not yet confirmed live
+        self._live_status_received = False
+        self._snapshot_slots = {}  # slot index -> snapshot slot, kept until reconciled
+        self._snapshot_device_info = {}
+        self._snapshot_saved_at = None
+        self._status_delta = AceStatusDelta()  # heartbeat results vs the previous one
+        self._slot_reconciled = {}  # slot index -> _slot_reconcile_key() after last pass
         self.inventory = create_inventory(self.SLOT_COUNT)
         self._feed_assist_index = -1
         self._feed_assist_topology_position = None  # Track chain position (0, 1, 2...)
@@ -134,6 +154,13 @@ class AceInstance:
         self.protocol = protocol or create_protocol_adapter(self.protocol_name)
         self.transport_spec = self.protocol.get_transport_spec()
         self.bus_session = bus_session
+        self.heartbeat_policy = AceHeartbeatPolicy(
+            self.heartbeat_interval,
+            busy_interval=ace_config.get("heartbeat_busy_interval", 0.15),
+            idle_interval=ace_config.get("heartbeat_idle_interval", 5.0),
+            idle_after=ace_config.get("heartbeat_idle_after", 300.0),
+            adaptive=bool(ace_config.get("adaptive_heartbeat", True)),
+        )
 
         self.serial_mgr = serial_mgr or AceSerialManager(
             self.gcode,
@@ -143,6 +170,16 @@ class AceInstance:
             status_debug_logging=self.status_debug_logging,
             supervision_enabled=self.supervision_enabled,
             protocol=self.protocol,
+            reader_mode=ace_config.get("serial_reader_mode", "fd"),
+            adaptive_timeouts=bool(ace_config.get("adaptive_request_timeouts", True)),
+            tx_rate_limit=ace_config.get("tx_rate_limit"),
+            tx_burst_bytes=ace_config.get("tx_burst_bytes"),
+            hotplug=bool(ace_config.get("hotplug_detection", True)),
+            port_inventory=port_inventory,
+            heartbeat_policy=None if self.transport_spec.shared_bus else self.heartbeat_policy,
+            wire_recorder=None if self.transport_spec.shared_bus else create_wire_recorder(
+                ace_config, f"ace{instance_num}", self.protocol_name
+            ),
         )
         self.tool_offset = get_tool_offset(self.instance_num)
         if not self.transport_spec.shared_bus:
@@ -150,6 +187,7 @@ class AceInstance:
         self.serial_mgr.set_on_connect_callback(self._on_ace_connect)
         self._dryer_start_logged = False  # prevent duplicate dryer start messages
         self._shared_bus_heartbeat_timer = None
+        self._next_shared_bus_heartbeat = None
 
     def _prepare_request(self, request):
         """Normalize request and attach ACE2 shared-bus target when known."""
@@ -181,6 +219,12 @@ class AceInstance:
         """Shortcut to the centralised :class:`PersistentState`."""
         return self.manager.state
 
+    def _note_startup_phase(self, phase):
+        """Report a startup phase to the manager's startup timeline."""
+        manager = self.manager
+        if manager is not None:
+            manager.note_startup_phase(self.instance_num, phase)
+
     def _register_tool_macros(self):
         """Register T0-T3 (or T4-T7, etc.) macros for this instance."""
         try:
@@ -214,6 +258,7 @@ class AceInstance:
             self._prepare_request(request),
             callback,
         )
+        self._note_command()
 
     def send_high_prio_request(self, request, callback):
         """Queue high-priority request."""
@@ -221,6 +266,25 @@ class AceInstance:
             self._prepare_request(request),
             callback,
         )
+        self._note_command()
+
+    def _note_command(self):
+        """Leave the idle heartbeat cadence and poll soon to catch the effect."""
+        self.heartbeat_policy.note_command(self.reactor.monotonic())
+        self._heartbeat_soon()
+
+    def _heartbeat_soon(self):
+        """Pull this unit's next status poll forward (see AceHeartbeatPolicy)."""
+        if not self.transport_spec.shared_bus:
+            self.serial_mgr.heartbeat_soon()
+            return
+        if self._shared_bus_heartbeat_timer is None:
+            return
+        due = self.reactor.monotonic() + self.heartbeat_policy.soonest_interval()
+        if self._next_shared_bus_heartbeat is not None and self._next_shared_bus_heartbeat <= due:
+            return
+        self._next_shared_bus_heartbeat = due
+        self.reactor.update_timer(self._shared_bus_heartbeat_timer, due)
 
     def _send_shared_bus_heartbeat_request(self):
         """Send one targeted ACE2 status poll over shared transport."""
@@ -228,7 +292,14 @@ class AceInstance:
             return
 
         request = self.protocol.build_get_status_request()
-        self.send_high_prio_request(request, self._on_heartbeat_response)
+        # Bypass send_high_prio_request: a status poll is not device activity.
+        # Like the single-unit heartbeat, a poll still queued when the next
+        # one is due is superseded by it.
+        self.serial_mgr.send_high_prio_request(
+            self._prepare_request(request),
+            self._on_heartbeat_response,
+            max_wait=self.heartbeat_policy.current_interval(self.reactor.monotonic()),
+        )
 
     def _shared_bus_heartbeat_tick(self, eventtime):
         """Periodically poll one ACE2 logical instance on shared transport."""
@@ -240,7 +311,8 @@ class AceInstance:
                 self.instance_num,
                 exc,
             )
-        return eventtime + self.heartbeat_interval
+        self._next_shared_bus_heartbeat = eventtime + self.heartbeat_policy.interval(eventtime)
+        return self._next_shared_bus_heartbeat
 
     def start_shared_bus_heartbeat(self):
         """Start or refresh shared-bus status polling after bus init completes."""
@@ -265,6 +337,8 @@ class AceInstance:
     def _handle_rfid_info_response(self, slot_idx, response):
         """Apply a get_filament_info response to the local inventory."""
         self._pending_rfid_queries.discard(slot_idx)
+        if not self._pending_rfid_queries:
+            self._note_startup_phase("rfid")
 
         if response and response.get("code") == 0 and "result" in response:
             result = response["result"]
@@ -386,11 +460,22 @@ class AceInstance:
 
     def wait_ready(self, on_wait_cycle=None, timeout_s=60.0):
         """Wait for ACE unit to be ready with a hard timeout."""
+        if self.is_ready():
+            return
+        # Poll at the busy cadence while blocked on the unit's status
+        self.heartbeat_policy.begin_wait(self.reactor.monotonic())
+        self._heartbeat_soon()
+        try:
+            self._wait_ready(on_wait_cycle, timeout_s)
+        finally:
+            self.heartbeat_policy.end_wait(self.reactor.monotonic())
+
+    def _wait_ready(self, on_wait_cycle, timeout_s):
         waited = 0.0
         interval = 0.5
         total_wait = 0.0
 
-        while self._info.get("status") != "ready":
+        while not self.is_ready():
             self.reactor.pause(self.reactor.monotonic() + interval)
             waited += interval
             total_wait += interval
@@ -411,8 +496,8 @@ class AceInstance:
                 )
 
     def is_ready(self):
-        """Check if ACE is ready."""
-        return self._info.get("status") == "ready"
+        """Check if ACE is ready; a status restored from the snapshot never is."""
+        return not self._status_stale and self._info.get("status") == "ready"
 
     def _update_feed_assist(self, slot_index):
         """Update feed assist state: enable if slot >= 0, disable if -1."""
@@ -1413,8 +1498,32 @@ class AceInstance:
         except Exception:
             pass
 
-    def _status_update_callback(self, response):
-        """Handle status updates from ACE hardware."""
+    def _slot_reconcile_key(self, idx, printing):
+        """Inventory state the reconciliation of slot ``idx`` depends on."""
+        inv = self.inventory[idx]
+        color = inv.get("color")
+        return (
+            len(inv),
+            inv.get("status"),
+            tuple(color) if isinstance(color, list) else color,
+            inv.get("material"),
+            inv.get("temp"),
+            inv.get("rfid"),
+            idx in self._pending_rfid_queries,
+            printing,
+            self.rfid_inventory_sync_enabled,
+        )
+
+    def _status_update_callback(self, response, dirty_slots=None):
+        """
+        Handle status updates from ACE hardware.
+
+        Args:
+            response: GET_STATUS response
+            dirty_slots: Slot indices whose payload changed since the previous
+                heartbeat, or None to reconcile every slot. Other slots are
+                skipped while their inventory entry is also unchanged.
+        """
         inventory_changed = False
         feed_assist_was_active = self._feed_assist_index
         filament_loaded = False
@@ -1433,22 +1542,44 @@ class AceInstance:
 
         if response and "result" in response:
             self._info = response["result"]
+            self._live_status_received = True
+            if self._status_stale:
+                self._reconcile_status_snapshot()
 
             # Handle pending RFID refresh after reconnect
             if self._pending_rfid_refresh:
                 self._pending_rfid_refresh = False
                 if self.rfid_inventory_sync_enabled:
-                    # Unconditionally query all slots to catch any spool changes during disconnect
+                    # Query all slots to catch any spool changes during disconnect,
+                    # warm start included: a swap for the same SKU and colour leaves
+                    # the snapshot diff empty but remaining length changed
                     for slot_idx in range(self.SLOT_COUNT):
                         logging.info(
                             f"ACE[{self.instance_num}]: Reconnect - querying RFID data for slot {slot_idx}"
                         )
                         self._query_rfid_full_data(slot_idx)
-
-            slots = self._info.get("slots", [])
+                if not self._pending_rfid_queries:
+                    self._note_startup_phase("rfid")
+
+            printing = self._is_printing_or_paused()
+            if dirty_slots is not None and not dirty_slots and all(
+                self._slot_reconciled.get(idx) == self._slot_reconcile_key(idx, printing)
+                for idx in range(self.SLOT_COUNT)
+            ):
+                # Nothing to reconcile: leave a lazily decoded slot array untouched
+                slots = []
+            else:
+                slots = self._info.get("slots", [])
             for slot in slots:
                 idx = slot.get("index")
                 if idx is not None and 0 <= idx < self.SLOT_COUNT:
+                    if (
+                        dirty_slots is not None
+                        and idx not in dirty_slots
+                        and self._slot_reconciled.get(idx) == self._slot_reconcile_key(idx, printing)
+                    ):
+                        continue
+
                     # Get saved metadata (material/color/temp)
                     saved_color = self.inventory[idx].get("color", [0, 0, 0])
                     saved_material = self.inventory[idx].get("material", "")
@@ -1637,6 +1768,7 @@ class AceInstance:
                         inv["material"] = updated_material
                         inv["temp"] = updated_temp
                         inv["rfid"] = updated_rfid
+                    self._slot_reconciled[idx] = self._slot_reconcile_key(idx, printing)
 
         # Persist changes if any status changed (deferred; flushed at print end)
         if inventory_changed:
@@ -1668,7 +1800,15 @@ class AceInstance:
 
         if response.get("code") == 0 and "result" in response:
             self._reset_status_failure_tracking()
-            self._status_update_callback(response)
+            self._note_startup_phase("status")
+            self.heartbeat_policy.note_status(
+                response["result"],
+                self.reactor.monotonic(),
+                printing=self._is_printing_or_paused(),
+                busy_is_idle=self._feed_assist_index >= 0 and self.protocol.feed_assist_causes_busy(),
+            )
+            _, dirty_slots = self._status_delta.update(response["result"])
+            self._status_update_callback(response, dirty_slots=dirty_slots)
 
             # Restore pending feed assist after first successful heartbeat
             self._maybe_restore_pending_feed_assist()
@@ -1787,6 +1927,8 @@ class AceInstance:
         # Set flag to refresh RFID data on next status update
         # This ensures we have current data if spools were changed during disconnect
         self._pending_rfid_refresh = True
+        # Reconcile every slot against the first status after (re)connecting
+        self._status_delta.reset()
         logging.info(
             f"ACE[{self.instance_num}]: Connected - will refresh RFID data after first status update"
         )
@@ -1824,6 +1966,90 @@ class AceInstance:
                 f"ACE[{self.instance_num}]: Feed assist restoration failed: {msg}"
             )
 
+    def build_status_snapshot(self):
+        """
+        Compact copy of the last live status and device info for warm start.
+
+        Returns None until a live status has been received this session, so
+        an unreachable unit does not overwrite its previous snapshot.
+        """
+        if not self._live_status_received or self._status_stale:
+            return None
+
+        status = {
+            key: copy.deepcopy(value)
+            for key, value in self._info.items()
+            if key not in ("slots", "raw_fields")
+        }
+        status["slots"] = [
+            {key: copy.deepcopy(slot[key]) for key in self.STATUS_SNAPSHOT_SLOT_KEYS if key in slot}
+            for slot in self._info.get("slots", [])
+            if isinstance(slot, dict)
+        ]
+
+        device_info = getattr(self.serial_mgr, "device_info", None)
+        if not isinstance(device_info, dict) or not device_info:
+            device_info = self._snapshot_device_info
+        return {
+            "version": self.STATUS_SNAPSHOT_VERSION,
+            "saved_at": time.time(),
+            "status": status,
+            "device_info": {
+                key: device_info[key]
+                for key in self.STATUS_SNAPSHOT_DEVICE_KEYS
+                if device_info.get(key) is not None
+            },
+        }
+
+    def restore_status_snapshot(self, snapshot):
+        """
+        Seed the slot view from a persisted snapshot, marked stale until a live status.
+
+        Only slots are restored. Device-level state (status, action, dryer)
+        may be hours old, so status stays "unknown" and is_ready() stays
+        false until the first live heartbeat.
+
+        Returns:
+            bool: True if the snapshot was usable
+        """
+        if not isinstance(snapshot, dict) or snapshot.get("version") != self.STATUS_SNAPSHOT_VERSION:
+            return False
+        status = snapshot.get("status")
+        if not isinstance(status, dict) or not isinstance(status.get("slots"), list):
+            return False
+
+        info = create_status_dict(self.SLOT_COUNT)
+        info["slots"] = copy.deepcopy(status["slots"])
+        info["status"] = "unknown"
+        self._info = info
+        self._snapshot_slots = {
+            slot.get("index"): slot for slot in info["slots"] if isinstance(slot, dict)
+        }
+        device_info = snapshot.get("device_info")
+        self._snapshot_device_info = dict(device_info) if isinstance(device_info, dict) else {}
+        self._snapshot_saved_at = snapshot.get("saved_at")
+        self._status_stale = True
+        return True
+
+    def _reconcile_status_snapshot(self):
+        """Clear the stale flag on the first live status, logging which slots changed."""
+        changed = []
+        live_slots = {
+            slot.get("index"): slot for slot in self._info.get("slots", []) if isinstance(slot, dict)
+        }
+        for idx in range(self.SLOT_COUNT):
+            live = live_slots.get(idx, {})
+            cached = self._snapshot_slots.get(idx, {})
+            if any(live.get(key) != cached.get(key) for key in self.STATUS_SNAPSHOT_SLOT_KEYS):
+                changed.append(idx)
+
+        logging.info(
+            f"ACE[{self.instance_num}]: Live status replaced snapshot - "
+            f"changed slots: {changed if changed else 'none'}"
+        )
+        self._status_stale = False
+        self._snapshot_slots = {}
+
     def get_status(self, eventtime=None):
         """Return status dict for Klipper/Moonraker queries."""
         # Debug logging reserved for status_debug_logging; keep silent by default
@@ -1834,9 +2060,14 @@ class AceInstance:
         status["protocol"] = self.protocol_name
         status["rfid_sync_enabled"] = bool(self.rfid_inventory_sync_enabled)
         status["feed_assist_slot"] = self._get_current_feed_assist_index()
+        status["stale"] = self._status_stale
+        if self._status_stale and isinstance(self._snapshot_saved_at, (int, float)):
+            status["snapshot_age_s"] = round(max(0.0, time.time() - self._snapshot_saved_at), 1)
 
-        # Attach device info from last get_info response, if available
+        # Attach device info from last get_info response (or the snapshot), if available
         device_info = getattr(self.serial_mgr, "device_info", {})
+        if not device_info and self._snapshot_device_info:
+            device_info = self._snapshot_device_info
         if isinstance(device_info, dict):
             normalized_info = {}
             for key in ("model", "firmware", "boot_firmware", "structure_version"):
@@ -1900,6 +2131,12 @@ class AceInstance:
         # Expose communication state machine for KlipperScreen connection indicator
         status["connection_state"] = getattr(self.serial_mgr, "connection_state", "unknown")
 
+        # Link health summary (full histograms: ACE_GET_CONNECTION_STATUS);
+        # shared-bus instances report their common transport
+        metrics = getattr(self.serial_mgr, "metrics", None)
+        if isinstance(metrics, AceTransportMetrics):
+            status["transport"] = metrics.summary()
+
         return status
 
     def dwell(self, delay=1.0, verbose=False):
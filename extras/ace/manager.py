@@ -22,7 +22,7 @@ from .config import (
 from .persistent_state import PersistentState
 
 from .instance import AceInstance
-from .ace2_bus import Ace2BusSession
+from .ace2_bus import Ace2BusBringUp, Ace2BusSession
 from .endless_spool import EndlessSpool
 from .runout_monitor import RunoutMonitor
 from .moonraker_lane_sync import MoonrakerLaneSyncAdapter
@@ -30,9 +30,11 @@ from . import commands
 from .config import read_ace_config
 from .protocol import create_protocol_adapter, resolve_protocol_name
 from .serial_manager import AceSerialManager
+from .port_inventory import AcePortInventory
+from .startup import AceStartupTimeline
+from .wire_recorder import create_wire_recorder
 import logging
 import serial
-import time
 
 
 class FilamentTrackerAdapter:
@@ -161,6 +163,14 @@ class AceManager:
 
         self._ace_pro_enabled = initial_ace_enabled
         self._shared_transport_contexts = {}
+        # One serial port enumeration shared by protocol auto-selection and
+        # every instance's port search; see AcePortInventory for invalidation.
+        self.port_inventory = AcePortInventory(
+            lambda: serial.tools.list_ports.comports(),
+            clock=lambda: self.reactor.monotonic(),
+        )
+        self.startup_timeline = AceStartupTimeline(lambda: self.reactor.monotonic())
+        self._startup_connect_logged = set()
 
         # Create all AceInstance objects
         self.instances = []
@@ -181,6 +191,7 @@ class AceManager:
                 ace_enabled=initial_ace_enabled,  # Pass initial state
                 protocol=protocol,
                 active_protocol_name=instance_config["active_protocol_name"],
+                port_inventory=self.port_inventory,
                 **shared_kwargs,
             )
 
@@ -199,6 +210,7 @@ class AceManager:
 
         # Load persisted inventory for all instances
         self._load_all_inventories()
+        self._load_all_status_snapshots()
 
         # Optional adapter for Orca/Moonraker filament sync.
         self._moonraker_lane_sync = MoonrakerLaneSyncAdapter(
@@ -252,6 +264,7 @@ class AceManager:
         self._shared_bus_last_connected_time = {}
         self._shared_bus_retry_timers = {}
         self._shared_bus_retry_delays = {}
+        self._shared_bus_bringups = {}  # id(bus_session) -> running Ace2BusBringUp
         self._shared_bus_retry_min_delay = 2.0
         self._shared_bus_retry_max_delay = 15.0
 
@@ -311,7 +324,21 @@ class AceManager:
         self.gcode.run_script_from_command(f"SET_PIN PIN=ACE_Pro VALUE={pin_value}")
 
         if self._ace_pro_enabled:
+            # Fresh enumeration for this connect wave, shared by all instances
+            self.port_inventory.invalidate("connect wave")
+            self.startup_timeline.start(instance.instance_num for instance in self.instances)
+            # All transports start probing in this reactor pass; each opens as
+            # soon as its device has enumerated instead of after a fixed delay.
             for instance in self._iter_unique_transport_instances():
+                instance.serial_mgr.startup_timeline = self.startup_timeline
+                # A shared ACE2 bus probes and opens once for every bound unit
+                instance.serial_mgr.startup_units = [
+                    item.instance_num for item in self.instances
+                    if item.serial_mgr is instance.serial_mgr
+                ]
+                instance.serial_mgr.set_on_connect_callback(
+                    lambda instance=instance: self._log_startup_connect(instance)
+                )
                 instance.serial_mgr.connect_to_ace(instance.baud, 2)
                 if instance.bus_session is not None and instance.serial_mgr._port:
                     instance.bus_session.port = instance.serial_mgr._port
@@ -328,6 +355,33 @@ class AceManager:
 
         self._start_monitoring()
 
+    def _log_startup_connect(self, instance):
+        """Log klippy:ready → first connect time for each transport, once."""
+        t0 = self.startup_timeline.t0
+        if t0 is None or instance.instance_num in self._startup_connect_logged:
+            return
+        self._startup_connect_logged.add(instance.instance_num)
+        elapsed = self.reactor.monotonic() - t0
+        inventory = self.port_inventory.snapshot()
+        logging.info(
+            f"ACE[{instance.instance_num}]: Connected {elapsed:.2f}s after klippy:ready "
+            f"(port scans: {inventory['scans']}, cached lookups: {inventory['hits']})"
+        )
+        expected = sum(1 for _ in self._iter_unique_transport_instances())
+        if len(self._startup_connect_logged) == expected:
+            self.gcode.respond_info(
+                f"ACE: All {expected} connection(s) up {elapsed:.2f}s after klippy:ready "
+                f"(ACE_STARTUP_REPORT for phase timings)"
+            )
+
+    def note_startup_phase(self, instance_num, phase):
+        """Record a startup phase; log the timing table once every unit is done."""
+        timeline = self.startup_timeline
+        if not timeline.mark(instance_num, phase) or not timeline.is_complete():
+            return
+        for line in timeline.format_report():
+            logging.info(line)
+
     def _handle_shutdown(self):
         """Called on Klipper emergency stop or fatal shutdown.
 
@@ -345,18 +399,30 @@ class AceManager:
         except Exception:
             logging.exception("ACE: Failed to flush state on shutdown")
 
+        # A hot-plug reconnect is pointless until FIRMWARE_RESTART
+        for instance in self._iter_unique_transport_instances():
+            try:
+                instance.serial_mgr.stop_hotplug_watcher()
+            except Exception:
+                logging.exception("ACE: Failed to stop hot-plug watcher on shutdown")
+
     def _handle_disconnect(self):
         """Called on Klipper disconnect. Stops monitoring and disconnects all ACE instances."""
         self.gcode.respond_info("ACE: Disconnecting")
 
         # Flush any dirty persistent state to disk before we tear down.
+        # A bad snapshot must not cost us the rest of the pending state.
+        try:
+            self._save_status_snapshots()
+        except Exception:
+            logging.exception("ACE: Failed to save status snapshots on disconnect")
         try:
             self.state.flush()
         except Exception:
             logging.exception("ACE: Failed to flush state on disconnect")
 
         for instance in self._iter_unique_transport_instances():
-            instance.serial_mgr.disconnect()
+            instance.serial_mgr.shutdown()
 
         self._stop_monitoring()
         self._restore_sensors()
@@ -1445,6 +1511,30 @@ class AceManager:
                 instance.inventory = create_inventory(SLOTS_PER_ACE)
                 self.gcode.respond_info(f"ACE[{instance.instance_num}]: " f"Initialized new inventory")
 
+    def _load_all_status_snapshots(self):
+        """
+        Warm-start each instance from its last persisted status snapshot.
+
+        The restored status is flagged stale until the first live heartbeat,
+        so UI and slot checks have data immediately after a restart.
+        """
+        for instance in self.instances:
+            varname = f"ace_status_snapshot_{instance.instance_num}"
+            snapshot = self.state.get(varname, None)
+            if not snapshot:
+                continue
+            if instance.restore_status_snapshot(snapshot):
+                logging.info(f"ACE[{instance.instance_num}]: Warm start from status snapshot")
+            else:
+                logging.info(f"ACE[{instance.instance_num}]: Ignoring unusable status snapshot")
+
+    def _save_status_snapshots(self):
+        """Store each instance's last live status for the next warm start."""
+        for instance in self.instances:
+            snapshot = instance.build_status_snapshot()
+            if snapshot is not None:
+                self.state.set(f"ace_status_snapshot_{instance.instance_num}", snapshot)
+
     def _sync_inventory_to_persistent(self, instance_num=None, flush=True):
         """
         Sync instance inventory to persistent storage.
@@ -2207,17 +2297,7 @@ class AceManager:
     def _get_available_port_descriptions(self):
         """List visible serial-port signatures for protocol auto-selection."""
         try:
-            signatures = []
-            for portinfo in serial.tools.list_ports.comports():
-                signature = getattr(portinfo, "description", "")
-                if not signature:
-                    signature = getattr(portinfo, "product", "")
-                if not signature:
-                    signature = getattr(portinfo, "interface", "")
-                if not signature:
-                    signature = getattr(portinfo, "hwid", "")
-                signatures.append(signature)
-            return signatures
+            return [port.signature for port in self.port_inventory.ports()]
         except Exception:
             return []
 
@@ -2247,6 +2327,12 @@ class AceManager:
         )
         return f"ace2_bus_bindings_{instance_ids}"
 
+    def _get_shared_bus_device_ids_varname(self, shared_instances):
+        """Persistent-state variable holding assigned device ids for one ACE2 bus group."""
+        return self._get_shared_bus_bindings_varname(shared_instances).replace(
+            "ace2_bus_bindings_", "ace2_bus_device_ids_", 1
+        )
+
     def _load_shared_bus_bindings(self, bus_session, shared_instances):
         """Restore persisted ACE2 UID bindings for one shared bus group."""
         raw_mapping = self.state.get(
@@ -2267,12 +2353,30 @@ class AceManager:
                 continue
         bus_session.bind_persisted_instances(normalized_mapping)
 
+    def _load_shared_bus_device_ids(self, shared_instances):
+        """Return persisted ACE2 device ids (instance -> id) for one shared bus group."""
+        raw_mapping = self.state.get(
+            self._get_shared_bus_device_ids_varname(shared_instances),
+            {},
+        )
+        device_ids = {}
+        for instance_num, device_id in dict(raw_mapping or {}).items():
+            try:
+                device_ids[int(instance_num)] = int(device_id)
+            except (TypeError, ValueError):
+                continue
+        return device_ids
+
     def _persist_shared_bus_bindings(self, bus_session, shared_instances):
-        """Store current ACE2 UID bindings for one shared bus group."""
+        """Store current ACE2 UID bindings and device ids for one shared bus group."""
         self.state.set(
             self._get_shared_bus_bindings_varname(shared_instances),
             bus_session.export_bindings(),
         )
+        self.state.set(
+            self._get_shared_bus_device_ids_varname(shared_instances),
+            bus_session.export_device_ids(),
+        )
 
     def _get_shared_bus_ready_instances(self, bus_session):
         """Return shared-bus instances that currently have an assigned target device id."""
@@ -2460,96 +2564,104 @@ class AceManager:
         if device is None or device.logical_instance is None:
             return False
 
-        for instance in self._get_instances_for_bus_session(bus_session):
-            if instance.instance_num == device.logical_instance:
-                return bool(instance.protocol.handle_bound_shared_bus_unsolicited(instance, response))
-
-        return False
-
-    def _send_shared_bus_request(self, instance, request, timeout_s=5.0):
-        """Send one manager-owned request over shared ACE2 transport and wait for reply."""
-        response_container = {"done": False, "response": None}
-
-        def callback(response):
-            response_container["response"] = response
-            response_container["done"] = True
-
-        instance.serial_mgr.send_high_prio_request(request, callback)
+        # self.instances is indexed by instance number
+        instance_num = device.logical_instance
+        if not 0 <= instance_num < len(self.instances):
+            return False
+        instance = self.instances[instance_num]
+        if getattr(instance, "bus_session", None) is not bus_session:
+            return False
+        return bool(instance.protocol.handle_bound_shared_bus_unsolicited(instance, response))
 
-        timeout_at = time.monotonic() + timeout_s
-        while not response_container["done"] and time.monotonic() < timeout_at:
-            self.reactor.pause(self.reactor.monotonic() + 0.05)
+    def _initialize_shared_bus_transport(self, instance, on_done=None):
+        """
+        Start discovery and device-id assignment on a shared ACE2 bus.
 
-        return response_container["response"]
+        The exchange runs as an Ace2BusBringUp driven by response callbacks,
+        so the reactor keeps serving other work while the bus answers.
+        ``on_done(ready_count)`` is called once it finishes; a bring-up still
+        running for the same bus is cancelled first.
 
-    def _initialize_shared_bus_transport(self, instance):
-        """Discover and assign ACE2 devices on a shared bus transport."""
+        Returns:
+            The Ace2BusBringUp, or None when there is nothing to initialize
+            (on_done is then called with 0 immediately).
+        """
+        on_done = on_done or (lambda ready_count: None)
         bus_session = getattr(instance, "bus_session", None)
         if bus_session is None:
-            return 0
+            on_done(0)
+            return None
 
         shared_instances = self._get_instances_for_bus_session(bus_session)
         if not shared_instances:
-            return 0
+            on_done(0)
+            return None
+
+        bus_key = id(bus_session)
+        previous = self._shared_bus_bringups.pop(bus_key, None)
+        if previous is not None:
+            previous.cancel()
 
         bus_session.reset()
         self._load_shared_bus_bindings(bus_session, shared_instances)
 
         protocol = getattr(instance.serial_mgr, "protocol", None)
         if protocol is None:
-            return 0
-
-        discovered_devices = []
-        for _ in range(len(shared_instances)):
-            response = self._send_shared_bus_request(
-                instance,
-                protocol.build_discover_device_request(),
-            )
-            if not response or "result" not in response:
-                break
-
-            result = response["result"]
-            device = bus_session.record_discovered_device(
-                result.get("uid1", 0),
-                result.get("uid2", 0),
-                result.get("uid3", 0),
-            )
-            discovered_devices.append(device)
+            on_done(0)
+            return None
 
-        if not discovered_devices:
+        def finished(bringup):
+            if self._shared_bus_bringups.get(bus_key) is bringup:
+                del self._shared_bus_bringups[bus_key]
+            on_done(self._finish_shared_bus_bringup(instance, bringup, shared_instances))
+
+        bringup = Ace2BusBringUp(
+            bus_session,
+            protocol,
+            instance.serial_mgr.send_high_prio_request,
+            [item.instance_num for item in shared_instances],
+            on_done=finished,
+            clock=self.reactor.monotonic,
+            log=lambda msg: self.gcode.respond_info(f"ACE[{instance.instance_num}]: {msg}"),
+            persisted_ids=self._load_shared_bus_device_ids(shared_instances),
+        )
+        self._shared_bus_bringups[bus_key] = bringup
+        bringup.start()
+        return bringup
+
+    def _finish_shared_bus_bringup(self, instance, bringup, shared_instances):
+        """Persist bindings and report one completed bring-up; returns the ready count."""
+        bus_session = bringup.session
+        stats = bringup.stats
+        if not bringup.found_count:
             self.gcode.respond_info(
                 f"ACE[{instance.instance_num}]: ACE2 discovery returned no devices on shared bus"
             )
             return 0
 
-        ordered_instances = sorted(shared_instances, key=lambda item: item.instance_num)
-        ordered_devices = list(bus_session.iter_discovered_devices())
-        for logical_instance, device in zip(ordered_instances, ordered_devices):
-            if device.logical_instance is None:
-                bus_session.bind_logical_instance(
-                    logical_instance.instance_num,
-                    device.identity.uid1,
-                    device.identity.uid2,
-                    device.identity.uid3,
-                )
-
-        for device in bus_session.build_assignment_plan(start_device_id=1):
-            response = self._send_shared_bus_request(
-                instance,
-                protocol.build_assign_device_id_request(
-                    device.identity.uid1,
-                    device.identity.uid2,
-                    device.identity.uid3,
-                    device.device_id,
-                ),
-            )
-            if not response or response.get("code") != 0:
-                self.gcode.respond_info(
-                    f"ACE[{instance.instance_num}]: ACE2 device-id assignment failed for UID={device.identity.uid_tuple}: {response}"
-                )
-
         self._persist_shared_bus_bindings(bus_session, shared_instances)
-        return len(self._get_shared_bus_ready_instances(bus_session))
+        ready_instances = self._get_shared_bus_ready_instances(bus_session)
+        ready_count = len(ready_instances)
+        # Bring-up is the shared bus's GET_INFO phase for each addressed unit
+        for item in ready_instances:
+            self.note_startup_phase(item.instance_num, "info")
+        message = (
+            f"ACE[{instance.instance_num}]: ACE2 bus up: {ready_count}/{len(shared_instances)} devices "
+            f"in {stats['total_s'] * 1000:.0f}ms"
+        )
+        if not stats["discovery_rounds"]:
+            message += f" ({stats['verified']} persisted device id(s) verified)"
+        else:
+            if stats["verified"]:
+                message += f", {stats['verified']} persisted device id(s) verified"
+            message += (
+                f" (discovery {stats['discovery_s'] * 1000:.0f}ms/{stats['discovery_rounds']} round(s), "
+                f"assignment {stats['assignment_s'] * 1000:.0f}ms/{stats['assign_rounds']} round(s))"
+            )
+        if stats["collisions"] or stats["retries"]:
+            message += f", {stats['collisions']} collision(s), {stats['retries']} retried request(s)"
+        self.gcode.respond_info(message)
+        return ready_count
 
     def _on_shared_bus_connected(self, bus_session):
         """Reinitialize and restart one ACE2 shared bus after connect."""
@@ -2564,7 +2676,13 @@ class AceManager:
         if last_connected_time is not None:
             self._shared_bus_last_connected_time[id(bus_session)] = last_connected_time
 
-        ready_count = self._initialize_shared_bus_transport(instance)
+        self._initialize_shared_bus_transport(
+            instance,
+            on_done=lambda ready_count: self._on_shared_bus_initialized(bus_session, ready_count),
+        )
+
+    def _on_shared_bus_initialized(self, bus_session, ready_count):
+        """Start runtime polling once bring-up has addressed at least one device."""
         if ready_count <= 0:
             self._schedule_shared_bus_retry(
                 bus_session,
@@ -2597,6 +2715,15 @@ class AceManager:
                 status_debug_logging=bool(instance_config.get("status_debug_logging", False)),
                 supervision_enabled=bool(instance_config.get("ace_connection_supervision", True)),
                 protocol=protocol,
+                reader_mode=instance_config.get("serial_reader_mode", "fd"),
+                adaptive_timeouts=bool(instance_config.get("adaptive_request_timeouts", True)),
+                tx_rate_limit=instance_config.get("tx_rate_limit"),
+                tx_burst_bytes=instance_config.get("tx_burst_bytes"),
+                hotplug=bool(instance_config.get("hotplug_detection", True)),
+                port_inventory=self.port_inventory,
+                wire_recorder=create_wire_recorder(
+                    instance_config, "ace_bus", instance_config["active_protocol_name"]
+                ),
             )
             bus_session = Ace2BusSession(port="", baud=instance_config["baud"])
             context = {
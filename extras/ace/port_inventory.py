@@ -0,0 +1,126 @@
+"""Shared snapshot of the host's serial ports."""
+
+from __future__ import annotations
+
+import logging
+import re
+import time
+from dataclasses import dataclass
+from typing import Callable, Iterable, Optional, Tuple
+
+
+_LOCATION_RE = re.compile(r'LOCATION=([-\w\.]+)')
+_ACM_RE = re.compile(r'ACM(\d+)')
+
+
+def port_location(device: str, hwid: str) -> str:
+    """USB location from the hwid, else "acm.N", else the device path."""
+    m = _LOCATION_RE.search(hwid or "")
+    if m:
+        return m.group(1)
+    m = _ACM_RE.search(device or "")
+    if m:
+        return f"acm.{m.group(1)}"
+    return device
+
+
+@dataclass(frozen=True)
+class AcePortInfo:
+    """One serial port as seen during enumeration."""
+
+    device: str
+    description: str
+    hwid: str
+    location: str
+    product: str = ""
+    interface: str = ""
+
+    @classmethod
+    def from_portinfo(cls, portinfo) -> "AcePortInfo":
+        device = str(getattr(portinfo, "device", "") or "")
+        hwid = str(getattr(portinfo, "hwid", "") or "")
+        return cls(
+            device=device,
+            description=str(getattr(portinfo, "description", "") or ""),
+            hwid=hwid,
+            location=port_location(device, hwid),
+            product=str(getattr(portinfo, "product", "") or ""),
+            interface=str(getattr(portinfo, "interface", "") or ""),
+        )
+
+    @property
+    def signature(self) -> str:
+        """Best human-readable identity for protocol auto-selection."""
+        return self.description or self.product or self.interface or self.hwid
+
+
+class AcePortInventory:
+    """
+    Enumerate serial ports once and share the result.
+
+    ``serial.tools.list_ports.comports()`` walks sysfs for every port, and
+    protocol auto-selection, each instance's port search, USB location and
+    description lookups all need the same list. The snapshot is kept until
+    invalidate() is called: on a hot-plug event, a failed connect, or at the
+    start of a new connect wave.
+    """
+
+    def __init__(self, lister: Callable[[], Iterable], clock: Callable[[], float] = time.monotonic):
+        self._lister = lister
+        self._clock = clock
+        self._ports: Optional[Tuple[AcePortInfo, ...]] = None
+        self._scanned_at = 0.0
+        self.scans = 0
+        self.hits = 0
+        self.invalidations = 0
+        self.last_invalidation = None
+
+    def ports(self) -> Tuple[AcePortInfo, ...]:
+        """Return the current snapshot, enumerating if there is none."""
+        if self._ports is not None:
+            self.hits += 1
+            return self._ports
+        try:
+            ports = tuple(AcePortInfo.from_portinfo(p) for p in self._lister())
+        except Exception as e:
+            logging.warning(f"ACE: Serial port enumeration failed: {e}")
+            return ()
+        self.scans += 1
+        self._ports = ports
+        self._scanned_at = self._clock()
+        return ports
+
+    def find(self, device: str) -> Optional[AcePortInfo]:
+        """Look up one port by device path in the snapshot."""
+        for port in self.ports():
+            if port.device == device:
+                return port
+        return None
+
+    def invalidate(self, reason: str) -> None:
+        """Drop the snapshot so the next lookup enumerates again."""
+        if self._ports is not None:
+            self.invalidations += 1
+            self.last_invalidation = reason
+        self._ports = None
+
+    def expire(self, max_age: float, reason: str) -> None:
+        """
+        Invalidate only a snapshot older than ``max_age`` seconds.
+
+        Several instances polling for their device on the same tick then
+        share one enumeration instead of each forcing its own.
+        """
+        if self._ports is not None and self._clock() - self._scanned_at < max_age:
+            return
+        self.invalidate(reason)
+
+    def snapshot(self):
+        """Return cache counters for status reporting."""
+        return {
+            "ports": len(self._ports) if self._ports is not None else None,
+            "scans": self.scans,
+            "hits": self.hits,
+            "invalidations": self.invalidations,
+            "last_invalidation": self.last_invalidation,
+        }
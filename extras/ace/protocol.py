@@ -7,6 +7,7 @@ here.  The concrete adapters are in ``protocol_ace1`` and ``protocol_ace2``.
 from __future__ import annotations
 
 from dataclasses import dataclass
+import time
 from typing import Any, Dict, Iterable, Mapping, Tuple
 
 
@@ -23,6 +24,7 @@ class AceCommandSpec:
     tier: str
     request_type: str | None = None
     response_type: str | None = None
+    timeout_s: float | None = None
 
 
 @dataclass(frozen=True)
@@ -33,6 +35,12 @@ class AceTransportSpec:
     port_description: str
     shared_bus: bool = False
     topology_validation: bool = True
+    # Outgoing byte budget: the ACE drops input beyond ~1 KiB in a short
+    # span. Pacing is opt-in (tx_rate_limit): no refill rate has been
+    # measured for the firmware, and the sliding window already bounds how
+    # much is outstanding, so a rate of 0 leaves writes unpaced by default.
+    tx_burst_bytes: int = 1024
+    tx_rate_bytes_s: float = 0.0
 
 
 DEFAULT_BAUD_BY_PROTOCOL = {
@@ -140,6 +148,139 @@ def get_default_baud_for_protocol(protocol_name: str | None) -> int:
     return DEFAULT_BAUD_BY_PROTOCOL[active_protocol]
 
 
+# ---------------------------------------------------------------------------
+# Incremental frame parser
+# ---------------------------------------------------------------------------
+
+ACE_FRAME_HEADER = b"\xFF\xAA"
+ACE_FRAME_TERMINATOR = 0xFE
+
+
+class AceFrameParser:
+    """
+    Incremental parser for ``FF AA ... FE`` framed serial input.
+
+    Bytes are appended to one buffer and parsed in place from a read offset;
+    frames are never re-sliced out of the buffer. Consumed bytes are only
+    dropped once they make up most of the buffer. When a header has been
+    seen but the frame is incomplete, the required length is remembered so
+    the next parse() resumes without searching for the header again.
+
+    Frame layout and payload decoding come from the protocol adapter via
+    ``FRAME_MIN_LENGTH``, ``frame_length()`` and ``decode_frame()``. With
+    ``metrics`` (an AceTransportMetrics) each decode_frame() call is timed
+    and reported through ``record_decode()``.
+    """
+
+    COMPACT_THRESHOLD = 4096
+
+    def __init__(self, adapter: "AceProtocolAdapter", crc_calculator, metrics=None):
+        self.adapter = adapter
+        self.crc_calculator = crc_calculator
+        self.metrics = metrics
+        self._buffer = bytearray()
+        self._offset = 0
+        self._pending_frame_len = 0
+
+    def __len__(self) -> int:
+        return len(self._buffer) - self._offset
+
+    def append(self, data) -> None:
+        """Queue raw serial bytes for the next parse()."""
+        self._buffer += data
+
+    def pending(self) -> bytearray:
+        """Return a copy of the unparsed bytes."""
+        return bytearray(self._buffer[self._offset:])
+
+    def pending_frame_length(self) -> int:
+        """Length of the partially received frame at the read offset, or 0."""
+        return self._pending_frame_len
+
+    def reset(self, data=b"") -> None:
+        """Discard all buffered input, optionally seeding new bytes."""
+        self._buffer = bytearray(data)
+        self._offset = 0
+        self._pending_frame_len = 0
+
+    def parse(self) -> tuple[list[dict[str, Any]], list[str]]:
+        """Parse every complete frame currently buffered."""
+        responses: list[dict[str, Any]] = []
+        notices: list[str] = []
+        buf = self._buffer
+        pos = self._offset
+        end = len(buf)
+        min_len = self.adapter.FRAME_MIN_LENGTH
+        metrics = self.metrics
+        view = memoryview(buf)
+        try:
+            while True:
+                frame_len = self._pending_frame_len
+                if frame_len:
+                    # Header already located on a previous call
+                    if end - pos < frame_len:
+                        break
+                    self._pending_frame_len = 0
+                else:
+                    if end - pos < min_len:
+                        break
+
+                    if not (buf[pos] == 0xFF and buf[pos + 1] == 0xAA):
+                        header_idx = buf.find(ACE_FRAME_HEADER, pos, end)
+                        if header_idx == -1:
+                            notices.append(f"Resync: dropped junk ({end - pos} bytes)")
+                            pos = end
+                            break
+                        notices.append(f"Resync: skipping {header_idx - pos} bytes")
+                        pos = header_idx
+                        if end - pos < min_len:
+                            break
+
+                    frame_len = self.adapter.frame_length(buf, pos)
+                    if end - pos < frame_len:
+                        self._pending_frame_len = frame_len
+                        break
+
+                if buf[pos + frame_len - 1] != ACE_FRAME_TERMINATOR:
+                    next_header = buf.find(ACE_FRAME_HEADER, pos + 1, end)
+                    pos = end if next_header == -1 else next_header
+                    notices.append("Invalid frame tail, resyncing")
+                    continue
+
+                if metrics is None:
+                    response, notice = self.adapter.decode_frame(
+                        view, pos, frame_len, self.crc_calculator
+                    )
+                else:
+                    decode_start = time.perf_counter()
+                    response, notice = self.adapter.decode_frame(
+                        view, pos, frame_len, self.crc_calculator
+                    )
+                    metrics.record_decode(time.perf_counter() - decode_start)
+                pos += frame_len
+                if notice:
+                    notices.append(notice)
+                if response is not None:
+                    responses.append(response)
+        finally:
+            view.release()
+
+        self._offset = pos
+        self._compact()
+        return responses, notices
+
+    def _compact(self) -> None:
+        """Drop consumed bytes once they dominate the buffer."""
+        if self._offset == 0:
+            return
+        if self._offset >= len(self._buffer):
+            self._buffer.clear()
+            self._offset = 0
+        elif self._offset >= self.COMPACT_THRESHOLD or self._offset * 2 >= len(self._buffer):
+            del self._buffer[:self._offset]
+            self._offset = 0
+
+
 # ---------------------------------------------------------------------------
 # Base adapter (abstract interface)
 # ---------------------------------------------------------------------------
@@ -147,17 +288,45 @@ def get_default_baud_for_protocol(protocol_name: str | None) -> int:
 class AceProtocolAdapter:
     """Base adapter for protocol-specific request construction."""
 
+    # Smallest buffered length from which frame_length() can be read
+    FRAME_MIN_LENGTH = 7
+
     def serialize_request_frame(self, request, crc_calculator) -> bytes:
         """Serialize one logical request into a transport frame."""
         raise NotImplementedError()
 
+    def frame_length(self, buffer: bytearray, start: int) -> int:
+        """Return the total length of the frame whose header is at ``start``."""
+        raise NotImplementedError()
+
+    def decode_frame(
+        self,
+        view: memoryview,
+        start: int,
+        frame_len: int,
+        crc_calculator,
+    ) -> tuple[dict[str, Any] | None, str | None]:
+        """Validate and decode one complete frame; returns (response, notice)."""
+        raise NotImplementedError()
+
+    def get_frame_cache_stats(self) -> Dict[str, int] | None:
+        """Return request frame cache counters, or None if not cached."""
+        return None
+
+    def create_frame_parser(self, crc_calculator) -> AceFrameParser:
+        """Return an incremental parser bound to this adapter's framing."""
+        return AceFrameParser(self, crc_calculator)
+
     def extract_responses(
         self,
         buffer: bytearray,
         crc_calculator,
     ) -> tuple[list[dict[str, Any]], bytearray, list[str]]:
         """Extract complete response objects from a raw serial buffer."""
-        raise NotImplementedError()
+        parser = self.create_frame_parser(crc_calculator)
+        parser.append(buffer)
+        responses, notices = parser.parse()
+        return responses, parser.pending(), notices
 
     def build_discover_device_request(self) -> Dict[str, Any]:
         """Build a request that discovers devices on a shared transport bus."""
@@ -197,6 +366,32 @@ class AceProtocolAdapter:
         """Return a transport-ready copy of a logical request."""
         raise NotImplementedError()
 
+    def get_request_command_name(self, request: Mapping[str, Any]) -> str | None:
+        """Return the command class used to group round-trip statistics."""
+        return request.get("command") or request.get("method")
+
+    def get_request_timeout_hint(self, request: Mapping[str, Any]) -> float | None:
+        """Return the expected response timeout for a request, if known."""
+        return None
+
+    def get_request_flow_key(self, request: Mapping[str, Any]) -> Any:
+        """
+        Return the scheduling flow (target device) of a request.
+
+        Requests of different flows share the window fairly; None means the
+        transport addresses a single device.
+        """
+        return None
+
+    def get_coalesce_key(self, request: Mapping[str, Any]) -> tuple | None:
+        """
+        Return a key identifying an idempotent read, or None.
+
+        Requests with equal keys that are queued or in flight at the same
+        time may share one frame and one response.
+        """
+        return None
+
     def build_get_info_request(self) -> Dict[str, Any]:
         """Build a logical request for device information."""
         raise NotImplementedError()
@@ -9,10 +9,23 @@ from typing import Any, Dict, Mapping, Tuple
 
 from .protocol import AceCommandSpec, AceProtocolAdapter, AceTransportSpec
 
+# Read-only ACE1 methods whose concurrent duplicates can share one response.
+ACE1_COALESCIBLE_METHODS = frozenset({"get_status", "get_info", "get_filament_info"})
+
 
 class AceJsonProtocolAdapter(AceProtocolAdapter):
     """ACE Gen1 adapter using the current JSON method/params format."""
 
+    # Upper bound on distinct cached frame templates (methods x slots)
+    FRAME_TEMPLATE_CACHE_SIZE = 64
+
+    def __init__(self):
+        # (key order, method, slot index) -> (payload prefix, payload suffix)
+        self._frame_templates: Dict[tuple, Tuple[bytes, bytes]] = {}
+        self._frame_cache_hits = 0
+        self._frame_cache_misses = 0
+        self._frame_cache_uncacheable = 0
+
     def get_transport_spec(self) -> AceTransportSpec:
         """ACE1 uses one USB serial device per physical ACE unit."""
         return AceTransportSpec(
@@ -35,7 +48,9 @@ class AceJsonProtocolAdapter(AceProtocolAdapter):
 
     def serialize_request_frame(self, request, crc_calculator) -> bytes:
         """Serialize an ACE1 JSON request into the current wire frame."""
-        payload = json.dumps(request).encode("utf-8")
+        payload = self._render_cached_payload(request)
+        if payload is None:
+            payload = json.dumps(request).encode("utf-8")
         data = bytearray([0xFF, 0xAA])
         data += struct.pack("<H", len(payload))
         data += payload
@@ -43,58 +58,102 @@ class AceJsonProtocolAdapter(AceProtocolAdapter):
         data += b"\xFE"
         return bytes(data)
 
-    def extract_responses(
-        self,
-        buffer: bytearray,
-        crc_calculator,
-    ) -> tuple[list[dict[str, Any]], bytearray, list[str]]:
-        """Parse ACE1 JSON frames from the input buffer."""
-        responses: list[dict[str, Any]] = []
-        notices: list[str] = []
-        working = bytearray(buffer)
-
-        while True:
-            if len(working) < 7:
-                break
-
-            if not (working[0] == 0xFF and working[1] == 0xAA):
-                header_idx = working.find(bytes([0xFF, 0xAA]))
-                if header_idx == -1:
-                    notices.append(f"Resync: dropped junk ({len(working)} bytes)")
-                    working = bytearray()
-                    break
-                notices.append(f"Resync: skipping {header_idx} bytes")
-                working = working[header_idx:]
-                if len(working) < 7:
-                    break
-
-            payload_len = struct.unpack("<H", working[2:4])[0]
-            frame_len = 2 + 2 + payload_len + 2 + 1
-            if len(working) < frame_len:
-                break
-
-            terminator_idx = 4 + payload_len + 2
-            if working[terminator_idx] != 0xFE:
-                next_header = working.find(bytes([0xFF, 0xAA]), 1)
-                working = bytearray() if next_header == -1 else working[next_header:]
-                notices.append("Invalid frame tail, resyncing")
+    @staticmethod
+    def _frame_template_key(request) -> tuple | None:
+        """
+        Return a cache key for requests whose JSON only varies by ``id``.
+
+        Cacheable requests carry a method, optionally a params dict that is
+        empty or holds a single integer ``index``, and an integer ``id`` as
+        the last key (which is how the serial manager stamps requests).
+        """
+        request_id = request.get("id")
+        if type(request_id) is not int:
+            return None
+        keys = tuple(request)
+        if keys[-1] != "id":
+            return None
+        method = request.get("method")
+        if not isinstance(method, str):
+            return None
+
+        index = None
+        for key in keys[:-1]:
+            if key == "method":
                 continue
+            if key != "params":
+                return None
+            params = request["params"]
+            if not isinstance(params, dict):
+                return None
+            if params:
+                if len(params) != 1 or type(params.get("index")) is not int:
+                    return None
+                index = params["index"]
+        return keys, method, index
+
+    def _render_cached_payload(self, request) -> bytes | None:
+        """Produce the JSON payload from a cached template, or None if uncacheable."""
+        key = self._frame_template_key(request)
+        if key is None:
+            self._frame_cache_uncacheable += 1
+            return None
+
+        template = self._frame_templates.get(key)
+        if template is None:
+            self._frame_cache_misses += 1
+            if len(self._frame_templates) >= self.FRAME_TEMPLATE_CACHE_SIZE:
+                return None
+            # Render once with a placeholder id, then split around it so
+            # later frames match json.dumps byte-for-byte.
+            probe = dict(request)
+            probe["id"] = 0
+            rendered = json.dumps(probe).encode("utf-8")
+            marker = b'"id": 0}'
+            if not rendered.endswith(marker):
+                return None
+            template = (rendered[:-2], b"}")
+            self._frame_templates[key] = template
+        else:
+            self._frame_cache_hits += 1
+
+        prefix, suffix = template
+        return prefix + str(request["id"]).encode("ascii") + suffix
+
+    def get_frame_cache_stats(self) -> Dict[str, int]:
+        """Return frame template cache counters."""
+        return {
+            "hits": self._frame_cache_hits,
+            "misses": self._frame_cache_misses,
+            "uncacheable": self._frame_cache_uncacheable,
+            "templates": len(self._frame_templates),
+        }
 
-            frame = bytes(working[:frame_len])
-            working = bytearray(working[frame_len:])
-            payload = frame[4:4 + payload_len]
-            crc_rx = frame[4 + payload_len:4 + payload_len + 2]
-            crc_calc = struct.pack("<H", crc_calculator(payload))
-            if crc_rx != crc_calc:
-                notices.append("Invalid CRC")
-                continue
+    FRAME_MIN_LENGTH = 7
 
-            try:
-                responses.append(json.loads(payload.decode("utf-8")))
-            except (UnicodeDecodeError, ValueError) as exc:
-                notices.append(f"JSON decode error: {exc}")
+    def frame_length(self, buffer: bytearray, start: int) -> int:
+        """ACE1 frame: header(2) + len(2) + JSON payload + CRC(2) + tail(1)."""
+        payload_len = buffer[start + 2] | (buffer[start + 3] << 8)
+        return 2 + 2 + payload_len + 2 + 1
 
-        return responses, working, notices
+    def decode_frame(
+        self,
+        view: memoryview,
+        start: int,
+        frame_len: int,
+        crc_calculator,
+    ) -> tuple[dict[str, Any] | None, str | None]:
+        """Check the CRC of one ACE1 frame and decode its JSON payload."""
+        payload_end = start + frame_len - 3
+        payload = view[start + 4:payload_end]
+        crc_rx = view[payload_end] | (view[payload_end + 1] << 8)
+        if crc_rx != crc_calculator(payload):
+            return None, "Invalid CRC"
+
+        try:
+            return json.loads(bytes(payload).decode("utf-8")), None
+        except (UnicodeDecodeError, ValueError) as exc:
+            return None, f"JSON decode error: {exc}"
 
     def build_discover_device_request(self) -> Dict[str, Any]:
         """ACE1 does not support shared-bus discovery."""
@@ -118,6 +177,16 @@ class AceJsonProtocolAdapter(AceProtocolAdapter):
         """Return a deep copy so transport mutation does not affect callers."""
         return deepcopy(request)
 
+    def get_coalesce_key(self, request: Mapping[str, Any]) -> tuple | None:
+        """Status/info reads (per slot for filament info) are safe to share."""
+        method = request.get("method")
+        if method not in ACE1_COALESCIBLE_METHODS:
+            return None
+        params = request.get("params") or {}
+        if set(params) - {"index"}:
+            return None
+        return (method, params.get("index"))
+
     def build_get_info_request(self) -> Dict[str, Any]:
         """Build the current ACE1 get_info request."""
         return {"method": "get_info"}
@@ -16,30 +16,30 @@ from .protocol import AceCommandSpec, AceProtocolAdapter, AceTransportSpec
 def _build_ace2_command_catalog() -> Tuple[AceCommandSpec, ...]:
     """Return the proto-derived ACE2 command catalog grouped by support tier."""
     return (
-        AceCommandSpec("DISCOVER_DEVICE", 0, "diagnostic", response_type="DiscoverDeviceResponse"),
-        AceCommandSpec("ASSIGN_DEVICE_ID", 1, "diagnostic", "AssignDeviceIdRequest", "GenericResponse"),
-        AceCommandSpec("GET_STATUS", 6, "operational", response_type="StatusResponse"),
-        AceCommandSpec("GET_INFO", 7, "operational", response_type="InfoResponse"),
+        AceCommandSpec("DISCOVER_DEVICE", 0, "diagnostic", response_type="DiscoverDeviceResponse", timeout_s=2.0),
+        AceCommandSpec("ASSIGN_DEVICE_ID", 1, "diagnostic", "AssignDeviceIdRequest", "GenericResponse", timeout_s=1.0),
+        AceCommandSpec("GET_STATUS", 6, "operational", response_type="StatusResponse", timeout_s=1.0),
+        AceCommandSpec("GET_INFO", 7, "operational", response_type="InfoResponse", timeout_s=1.0),
         AceCommandSpec("FEED_OR_ROLLBACK", 8, "operational", "FeedOrRollbackRequest", "GenericResponse"),
         AceCommandSpec("STOP_FEED_OR_ROLLBACK", 9, "operational", "StopFeedOrRollbackRequest", "GenericResponse"),
         AceCommandSpec("UPDATE_SPEED", 10, "operational", "UpdateSpeedRequest", "GenericResponse"),
         AceCommandSpec("DRYING", 11, "operational", "DryingRequest", "GenericResponse"),
         AceCommandSpec("SET_DRY_TEMP", 12, "diagnostic", "SetDryTempRequest", "GenericResponse"),
-        AceCommandSpec("GET_FILAMENT_INFO", 13, "operational", "RfidRequest", "FilamentInfoResponse"),
+        AceCommandSpec("GET_FILAMENT_INFO", 13, "operational", "RfidRequest", "FilamentInfoResponse", timeout_s=3.0),
         AceCommandSpec("SET_RFID_ENABLE", 14, "diagnostic", "SetRfidEnableRequest", "GenericResponse"),
         AceCommandSpec("LINEAR_KEY_CALIBRATE", 15, "debug", "LinearCalibrationRequest", "GenericResponse"),
         AceCommandSpec("SET_FEED_CHECK", 19, "diagnostic", "SetFeedCheckRequest", "GenericResponse"),
-        AceCommandSpec("GET_TEMP", 64, "diagnostic", response_type="GetTempResponse"),
+        AceCommandSpec("GET_TEMP", 64, "diagnostic", response_type="GetTempResponse", timeout_s=1.0),
         AceCommandSpec("SET_DRY_POWER", 65, "debug", "SetDryPowerRequest", "GenericResponse"),
         AceCommandSpec("SET_VALVE", 66, "debug", "SetValveRequest", "GenericResponse"),
-        AceCommandSpec("FILAMENT_IDENTIFY", 68, "diagnostic", "RfidRequest", "GenericResponse"),
+        AceCommandSpec("FILAMENT_IDENTIFY", 68, "diagnostic", "RfidRequest", "GenericResponse", timeout_s=3.0),
         AceCommandSpec("RFID_TEST", 69, "debug", "RfidTestRequest", "GenericResponse"),
         AceCommandSpec("FLASH_LED", 70, "debug", "FlashLedRequest", "GenericResponse"),
         AceCommandSpec("SET_FAN", 71, "debug", "SetFanRequest", "GenericResponse"),
         AceCommandSpec("SET_OUTPUT", 72, "debug", "SetOutputRequest", "GenericResponse"),
-        AceCommandSpec("GET_KEY_STATE", 73, "diagnostic", response_type="KeyStateResponse"),
+        AceCommandSpec("GET_KEY_STATE", 73, "diagnostic", response_type="KeyStateResponse", timeout_s=1.0),
         AceCommandSpec("SET_PTC_TEMP", 75, "debug", "SetDryTempRequest", "GenericResponse"),
-        AceCommandSpec("GET_FEED_INFO", 76, "diagnostic", response_type="FeedInfoResponse"),
+        AceCommandSpec("GET_FEED_INFO", 76, "diagnostic", response_type="FeedInfoResponse", timeout_s=1.0),
     )
 
 
@@ -53,6 +53,8 @@ ACE2_GENERIC_RESPONSE_COMMANDS = {
     for spec in ACE2_COMMAND_CATALOG
     if spec.response_type == "GenericResponse"
 }
+# Read-only commands whose concurrent duplicates can share one response.
+ACE2_COALESCIBLE_COMMANDS = frozenset({"GET_STATUS", "GET_INFO", "GET_FILAMENT_INFO"})
 ACE2_BOUND_GENERIC_ACK_COMMANDS = {
     spec.name
     for spec in ACE2_COMMAND_CATALOG
@@ -214,6 +216,493 @@ def _pb_first(fields: dict[int, list[tuple[int, Any]]], field: int, default: Any
     return fields.get(field, [(0, default)])[0][1]
 
 
+# ---------------------------------------------------------------------------
+# ACE2 message schemas and generated codecs
+# ---------------------------------------------------------------------------
+
+# Field layouts of the request/response messages named in the command catalog,
+# as (field number, key, kind). Kinds: "uint" and "bool" (varint), "string",
+# "float" (fixed32 float, varint also accepted), ("message", type) and
+# ("repeated", type) for nested messages.
+ACE2_MESSAGE_SCHEMAS: Dict[str, Tuple[tuple, ...]] = {
+    "DiscoverDeviceResponse": ((1, "uid1", "uint"), (2, "uid2", "uint"), (3, "uid3", "uint")),
+    "GenericResponse": ((1, "code", "uint"),),
+    "InfoResponse": ((1, "version", "string"), (2, "boot_version", "string"), (3, "first_request", "bool")),
+    "DryStatus": (
+        (1, "state", "uint"),
+        (2, "target_temp", "uint"),
+        (3, "duration", "uint"),
+        (4, "remain_time", "uint"),
+    ),
+    "SlotStatus": ((1, "state", "uint"), (2, "filament_state", "uint")),
+    "StatusResponse": (
+        (1, "work_state", "uint"),
+        (2, "dry_status", ("message", "DryStatus")),
+        (3, "temp", "uint"),
+        (4, "humidity", "uint"),
+        (7, "feed_assist_count", "uint"),
+        (8, "cont_assist_time", "uint"),
+        (9, "slots", ("repeated", "SlotStatus")),
+    ),
+    "Color": ((1, "rgba", "uint"),),
+    "ExtruderTemp": ((1, "min", "uint"), (2, "max", "uint"), (3, "min_speed", "uint"), (4, "max_speed", "uint")),
+    "HotbedTemp": ((1, "min", "uint"), (2, "max", "uint")),
+    "FilamentInfoResponse": (
+        (1, "index", "uint"),
+        (2, "version", "uint"),
+        (3, "sku", "string"),
+        (4, "type", "string"),
+        (5, "colors", ("repeated", "Color")),
+        (6, "extruder_temp", ("message", "ExtruderTemp")),
+        (7, "hotbed_temp", ("message", "HotbedTemp")),
+        (8, "diameter", "float"),
+        (9, "total", "uint"),
+        (10, "icon_type", "uint"),
+        (11, "current", "uint"),
+        (12, "code", "uint"),
+    ),
+    "AssignDeviceIdRequest": ((1, "uid1", "uint"), (2, "uid2", "uint"), (3, "uid3", "uint"), (4, "device_id", "uint")),
+    "RfidRequest": ((1, "index", "uint"),),
+    "StopFeedOrRollbackRequest": ((1, "index", "uint"),),
+    "UpdateSpeedRequest": ((1, "index", "uint"), (2, "speed", "uint")),
+    "FeedOrRollbackRequest": ((1, "index", "uint"), (2, "speed", "uint"), (3, "length", "uint"), (4, "mode", "uint")),
+    "DryingRequest": ((1, "temp", "uint"), (2, "duration", "uint"), (3, "auto_roll", "bool", False)),
+    "SetDryTempRequest": ((1, "temp", "uint"),),
+    "SetRfidEnableRequest": ((1, "index", "uint"), (2, "enable", "bool")),
+    "LinearCalibrationRequest": ((1, "id", "uint"), (2, "type", "uint")),
+    "SetFeedCheckRequest": ((1, "check_length", "uint"), (2, "error_length", "uint")),
+    "SetDryPowerRequest": ((1, "power", "uint"),),
+    "SetValveRequest": ((1, "valve1", "bool"), (2, "valve2", "bool")),
+    "RfidTestRequest": ((1, "enable", "bool"),),
+    "FlashLedRequest": (
+        (1, "components", "uint"),
+        (2, "loop", "uint"),
+        (3, "quick1", "uint"),
+        (4, "slow1", "uint"),
+        (5, "quick2", "uint"),
+        (6, "slow2", "uint"),
+    ),
+    "SetFanRequest": ((1, "speed", "uint"), (2, "fan1", "bool"), (3, "fan2", "bool")),
+    "SetOutputRequest": ((1, "components", "uint"), (2, "state", "uint")),
+}
+
+
+# Messages whose nested messages are left as raw bytes by the generated
+# decoder (GET_STATUS: see Ace2StatusResult)
+ACE2_RAW_NESTED_TYPES = frozenset({"StatusResponse"})
+
+
+class Ace2CodecFallback(Exception):
+    """Payload shape the generated decoder does not cover; use the generic path."""
+
+
+def _pb_read_varint(data: bytes, pos: int) -> tuple[int, int]:
+    """Strict varint read for generated decoders (IndexError when truncated)."""
+    result = 0
+    shift = 0
+    while True:
+        byte = data[pos]
+        pos += 1
+        result |= (byte & 0x7F) << shift
+        if byte < 0x80:
+            return result, pos
+        shift += 7
+
+
+def _pb_skip_field(data: bytes, pos: int, wire_type: int) -> int:
+    """Skip one unknown field value for generated decoders."""
+    if wire_type == 0:
+        return _pb_read_varint(data, pos)[1]
+    if wire_type == 2:
+        length, pos = _pb_read_varint(data, pos)
+    elif wire_type == 5:
+        length = 4
+    else:
+        raise Ace2CodecFallback()
+    pos += length
+    if pos > len(data):
+        raise Ace2CodecFallback()
+    return pos
+
+
+_PB_FLOAT = struct.Struct("<f")
+
+
+def _generate_message_decoder(type_name: str, decoders: Dict[str, Any]) -> Any:
+    """
+    Compile a decoder returning the message's fields as a tuple in schema order.
+
+    Values follow ``_pb_decode`` + ``_pb_first`` semantics: the first
+    occurrence of a field wins, absent fields take the kind's default, and
+    strings are decoded with ``errors="ignore"``. Payloads those helpers
+    would read differently (a known field on an unexpected wire type,
+    truncated input, group wire types) raise ``Ace2CodecFallback``.
+
+    For types in ``ACE2_RAW_NESTED_TYPES`` nested messages are returned as
+    raw payload bytes (None when absent) for the caller to decode on demand;
+    their decoders are still generated into ``decoders``.
+    """
+    schema = ACE2_MESSAGE_SCHEMAS[type_name]
+    raw_nested = type_name in ACE2_RAW_NESTED_TYPES
+    namespace: Dict[str, Any] = {
+        "_read_varint": _pb_read_varint,
+        "_skip_field": _pb_skip_field,
+        "_unpack_float": _PB_FLOAT.unpack_from,
+        "Fallback": Ace2CodecFallback,
+        "KNOWN": frozenset(number for number, *_ in schema),
+    }
+    lines = [f"def decode_{type_name}(data):"]
+    for slot, (_, _, kind, *_rest) in enumerate(schema):
+        repeated = isinstance(kind, tuple) and kind[0] == "repeated"
+        lines.append(f"    v{slot} = []" if repeated else f"    v{slot} = None")
+    lines += [
+        "    pos = 0",
+        "    end = len(data)",
+        "    while pos < end:",
+        "        tag = data[pos]",
+        "        if tag < 0x80:",
+        "            pos += 1",
+        "        else:",
+        "            tag, pos = _read_varint(data, pos)",
+    ]
+    branch = "if"
+
+    def read_varint(target: str) -> list:
+        return [
+            f"            {target} = data[pos]",
+            f"            if {target} < 0x80:",
+            "                pos += 1",
+            "            else:",
+            f"                {target}, pos = _read_varint(data, pos)",
+        ]
+
+    defaults = []
+    for slot, (number, _, kind, *_rest) in enumerate(schema):
+        var = f"v{slot}"
+        if kind in ("uint", "bool", "float"):
+            lines.append(f"        {branch} tag == {number << 3}:")
+            lines += read_varint("value")
+            lines.append(f"            if {var} is None: {var} = value")
+            defaults.append("0")
+            if kind == "float":
+                lines += [
+                    f"        elif tag == {(number << 3) | 5}:",
+                    "            if pos + 4 > end: raise Fallback()",
+                    "            value = _unpack_float(data, pos)[0]",
+                    "            pos += 4",
+                    f"            if {var} is None: {var} = value",
+                ]
+        else:
+            lines.append(f"        {branch} tag == {(number << 3) | 2}:")
+            lines += read_varint("length")
+            lines += [
+                "            stop = pos + length",
+                "            if stop > end: raise Fallback()",
+            ]
+            if kind == "string":
+                lines.append(f"            if {var} is None: {var} = data[pos:stop].decode(errors='ignore')")
+                defaults.append("''")
+            else:
+                sub_name = kind[1]
+                sub = decoders.get(sub_name) or _generate_message_decoder(sub_name, decoders)
+                namespace[f"decode_{sub_name}"] = sub
+                if raw_nested and kind[0] == "repeated":
+                    lines.append(f"            {var}.append(data[pos:stop])")
+                    defaults.append(None)
+                elif raw_nested:
+                    lines.append(f"            if {var} is None: {var} = data[pos:stop]")
+                    defaults.append(None)
+                elif kind[0] == "repeated":
+                    lines.append(f"            {var}.append(decode_{sub_name}(data[pos:stop]))")
+                    defaults.append(None)
+                else:
+                    lines.append(f"            if {var} is None: {var} = decode_{sub_name}(data[pos:stop])")
+                    namespace[f"EMPTY_{sub_name}"] = sub(b"")
+                    defaults.append(f"EMPTY_{sub_name}")
+            lines.append("            pos = stop")
+        branch = "elif"
+    lines += [
+        "        elif (tag >> 3) in KNOWN:",
+        "            raise Fallback()",
+        "        else:",
+        "            pos = _skip_field(data, pos, tag & 7)",
+        "    return (",
+    ]
+    for slot, default in enumerate(defaults):
+        lines.append(f"        v{slot}," if default is None else f"        {default} if v{slot} is None else v{slot},")
+    lines.append("    )")
+    exec(compile("\n".join(lines), f"<ace2 decoder {type_name}>", "exec"), namespace)
+    decoder = namespace[f"decode_{type_name}"]
+    decoders[type_name] = decoder
+    return decoder
+
+
+def _generate_message_encoder(type_name: str) -> Any:
+    """
+    Compile an encoder taking a params mapping, with each tag as a constant.
+
+    Matches the ``_pb_uint32`` / ``_pb_bool`` concatenation it replaces:
+    every field is always emitted, and a missing required param raises
+    KeyError.
+    """
+    schema = ACE2_MESSAGE_SCHEMAS[type_name]
+    namespace: Dict[str, Any] = {"_varint": _pb_varint}
+    parts = []
+    for number, key, kind, *default in schema:
+        tag = _pb_varint(number << 3)
+        value = f"params[{key!r}]" if not default else f"params.get({key!r}, {default[0]!r})"
+        if kind == "bool":
+            parts.append(f"({tag!r} + (b'\\x01' if {value} else b'\\x00'))")
+        elif kind == "uint":
+            parts.append(f"{tag!r} + _varint(int({value}))")
+        else:
+            raise ValueError(f"ACE2 request field kind {kind!r} is not encodable ({type_name}.{key})")
+    source = f"def encode_{type_name}(params):\n    return " + " + ".join(parts) + "\n"
+    exec(compile(source, f"<ace2 encoder {type_name}>", "exec"), namespace)
+    return namespace[f"encode_{type_name}"]
+
+
+def _empty_payload(params: Mapping[str, Any]) -> bytes:
+    return b""
+
+
+def _build_generated_codecs() -> tuple[Dict[str, Any], Dict[str, Any], Dict[str, Any]]:
+    """Generate request encoders and response decoders for every catalog command."""
+    decoders: Dict[str, Any] = {}
+    encoders_by_type: Dict[str, Any] = {}
+    request_encoders: Dict[str, Any] = {}
+    response_decoders: Dict[str, Any] = {}
+    for spec in ACE2_COMMAND_CATALOG:
+        if spec.request_type is None:
+            request_encoders[spec.name] = _empty_payload
+        elif spec.request_type in ACE2_MESSAGE_SCHEMAS:
+            encoder = encoders_by_type.get(spec.request_type)
+            if encoder is None:
+                encoder = encoders_by_type[spec.request_type] = _generate_message_encoder(spec.request_type)
+            request_encoders[spec.name] = encoder
+        if spec.response_type in ACE2_MESSAGE_SCHEMAS:
+            response_decoders[spec.name] = (
+                decoders.get(spec.response_type)
+                or _generate_message_decoder(spec.response_type, decoders)
+            )
+    return request_encoders, response_decoders, decoders
+
+
+def _reference_message_tuple(type_name: str, payload: bytes) -> tuple:
+    """Read a flat message through ``_pb_decode`` into the generated tuple shape."""
+    fields = _pb_decode(payload)
+    values = []
+    for number, _, kind, *_rest in ACE2_MESSAGE_SCHEMAS[type_name]:
+        if kind == "string":
+            value = _pb_first(fields, number, b"")
+            values.append(value.decode(errors="ignore") if isinstance(value, bytes) else value)
+        else:
+            values.append(_pb_first(fields, number, 0))
+    return tuple(values)
+
+
+def _decode_nested_message(type_name: str, payload: bytes | None) -> tuple:
+    """Decode a nested message kept raw by its parent; generic reading on fallback."""
+    payload = payload or b""
+    try:
+        return ACE2_MESSAGE_DECODERS[type_name](payload)
+    except (Ace2CodecFallback, IndexError):
+        return _reference_message_tuple(type_name, payload)
+
+
+ACE2_REQUEST_ENCODERS, ACE2_RESPONSE_DECODERS, ACE2_MESSAGE_DECODERS = _build_generated_codecs()
+
+
+def _ace2_dryer_status(dry_status: tuple) -> Dict[str, Any]:
+    """Build the ``dryer_status`` dict from a generated DryStatus tuple."""
+    dry_state_code, target_temp, duration, remain_time = dry_status
+    return {
+        "status": ACE2_DRY_STATUS_BY_CODE.get(dry_state_code, "unknown"),
+        "state_detail": ACE2_DRY_STATE_DETAIL_BY_CODE.get(dry_state_code, "unknown"),
+        "state_code": dry_state_code,
+        "target_temp": target_temp,
+        "duration": duration,
+        "remain_time": remain_time,
+    }
+
+
+def _ace2_slot_statuses(slot_states: list) -> list:
+    """Build the ``slots`` list from generated SlotStatus tuples."""
+    slots = []
+    for index, (slot_state, filament_state) in enumerate(slot_states):
+        if filament_state == 0:
+            normalized_slot_state = "empty"
+            slot_status_detail = "empty"
+        else:
+            normalized_slot_state = ACE2_SLOT_STATUS_BY_CODE.get(
+                slot_state,
+                "gear_err" if slot_state >= 129 else "ready",
+            )
+            slot_status_detail = ACE2_SLOT_STATUS_DETAIL_BY_CODE.get(slot_state, "unknown")
+        slots.append(
+            {
+                "index": index,
+                "status": normalized_slot_state,
+                "status_detail": slot_status_detail,
+                "status_code": slot_state,
+                "rfid": ACE2_FILAMENT_TO_RFID_STATE.get(filament_state, 0),
+            }
+        )
+    return slots
+
+
+class Ace2StatusResult(dict):
+    """
+    GET_STATUS ``result`` that decodes its dryer block and slot array on use.
+
+    The scalar fields are stored eagerly. ``dryer_status`` and ``slots`` stay
+    as raw protobuf bytes until they are read through ``[]``, ``get()``,
+    iteration, comparison or copying, and are then built exactly as the
+    reference decoder builds them. Any mutation materialises both first, so
+    the object otherwise behaves as the plain dict it replaces.
+
+    ``delta_key`` holds the scalars and raw nested payloads; AceStatusDelta
+    compares it instead of the decoded values, so an unchanged heartbeat
+    never decodes its slots.
+    """
+
+    __slots__ = ("delta_key", "_dryer_payload", "_slot_payloads", "_pending")
+
+    KEY_ORDER = (
+        "status",
+        "status_code",
+        "dryer_status",
+        "temp",
+        "humidity",
+        "feed_assist_count",
+        "cont_assist_time",
+        "slots",
+    )
+
+    def __init__(self, message: tuple):
+        work_state_code, dryer_payload, temp, humidity, feed_assist_count, cont_assist_time, slot_payloads = message
+        super().__init__(
+            status=ACE2_WORK_STATUS_BY_CODE.get(work_state_code, "unknown"),
+            status_code=work_state_code,
+            temp=temp,
+            humidity=humidity,
+            feed_assist_count=feed_assist_count,
+            cont_assist_time=cont_assist_time,
+        )
+        self._dryer_payload = dryer_payload
+        self._slot_payloads = slot_payloads
+        self._pending = ["dryer_status", "slots"]
+        self.delta_key = (
+            (work_state_code, temp, humidity, feed_assist_count, cont_assist_time, dryer_payload),
+            tuple(slot_payloads),
+        )
+
+    def _load(self, key: str) -> Any:
+        self._pending.remove(key)
+        if key == "dryer_status":
+            value = _ace2_dryer_status(_decode_nested_message("DryStatus", self._dryer_payload))
+        else:
+            value = _ace2_slot_statuses(
+                [_decode_nested_message("SlotStatus", payload) for payload in self._slot_payloads]
+            )
+        dict.__setitem__(self, key, value)
+        return value
+
+    def materialize(self) -> "Ace2StatusResult":
+        """Decode every pending field and restore the reference key order."""
+        if self._pending:
+            for key in tuple(self._pending):
+                self._load(key)
+            ordered = [(key, dict.__getitem__(self, key)) for key in self.KEY_ORDER]
+            extra = [(key, value) for key, value in dict.items(self) if key not in self.KEY_ORDER]
+            dict.clear(self)
+            dict.update(self, ordered + extra)
+        return self
+
+    def __getitem__(self, key):
+        if key in self._pending:
+            return self._load(key)
+        return dict.__getitem__(self, key)
+
+    def get(self, key, default=None):
+        if key in self._pending:
+            return self._load(key)
+        return dict.get(self, key, default)
+
+    def __contains__(self, key) -> bool:
+        return key in self._pending or dict.__contains__(self, key)
+
+    def __len__(self) -> int:
+        return dict.__len__(self) + len(self._pending)
+
+    def __iter__(self):
+        return dict.__iter__(self.materialize())
+
+    def keys(self):
+        return dict.keys(self.materialize())
+
+    def values(self):
+        return dict.values(self.materialize())
+
+    def items(self):
+        return dict.items(self.materialize())
+
+    def __eq__(self, other):
+        return dict.__eq__(self.materialize(), other)
+
+    def __ne__(self, other):
+        return dict.__ne__(self.materialize(), other)
+
+    __hash__ = None
+
+    def __repr__(self) -> str:
+        return dict.__repr__(self.materialize())
+
+    def copy(self) -> Dict[str, Any]:
+        return dict(self.materialize())
+
+    def __copy__(self) -> Dict[str, Any]:
+        return self.copy()
+
+    def __deepcopy__(self, memo) -> Dict[str, Any]:
+        return deepcopy(dict(self.materialize()), memo)
+
+    def __reduce__(self):
+        return dict, (dict(self.materialize()),)
+
+    def __setitem__(self, key, value) -> None:
+        dict.__setitem__(self.materialize(), key, value)
+
+    def __delitem__(self, key) -> None:
+        dict.__delitem__(self.materialize(), key)
+
+    def pop(self, key, *default):
+        return dict.pop(self.materialize(), key, *default)
+
+    def popitem(self):
+        return dict.popitem(self.materialize())
+
+    def setdefault(self, key, default=None):
+        return dict.setdefault(self.materialize(), key, default)
+
+    def update(self, *args, **kwargs) -> None:
+        dict.update(self.materialize(), *args, **kwargs)
+
+    def clear(self) -> None:
+        self._pending = []
+        dict.clear(self)
+
+    def __or__(self, other):
+        return dict(self.materialize()) | other
+
+    def __ror__(self, other):
+        return other | dict(self.materialize())
+
+    def __ior__(self, other):
+        self.update(other)
+        return self
+
+
 # ---------------------------------------------------------------------------
 # ACE2 protocol adapter
 # ---------------------------------------------------------------------------
@@ -222,6 +711,9 @@ def _pb_first(fields: dict[int, list[tuple[int, Any]]], field: int, default: Any
 class AceProtoProtocolAdapter(AceProtocolAdapter):
     """ACE2 adapter scaffold using command/payload requests for shared-bus transport."""
 
+    # Keep the generic field dict on GET_STATUS results (status debug logging)
+    include_raw_fields = False
+
     def get_transport_spec(self) -> AceTransportSpec:
         """ACE2 reaches logical devices via shared RS-485 bus."""
         return AceTransportSpec(
@@ -269,7 +761,16 @@ class AceProtoProtocolAdapter(AceProtocolAdapter):
         }
 
     def _encode_request_payload(self, command_name: str, params: Mapping[str, Any]) -> bytes:
-        """Encode supported ACE2 request payloads as protobuf bytes."""
+        """Encode an ACE2 request payload with the generated per-message encoder."""
+        encoder = ACE2_REQUEST_ENCODERS.get(command_name)
+        if encoder is None:
+            raise NotImplementedError(
+                f"ACE2 payload encoding is not implemented yet for command '{command_name}'"
+            )
+        return encoder(params)
+
+    def _encode_request_payload_reference(self, command_name: str, params: Mapping[str, Any]) -> bytes:
+        """Hand-written request encoding; reference for the generated encoders."""
         if command_name in {
             "DISCOVER_DEVICE",
             "GET_INFO",
@@ -344,7 +845,70 @@ class AceProtoProtocolAdapter(AceProtocolAdapter):
         )
 
     def _decode_response_payload(self, command_name: str, payload: bytes) -> dict[str, Any]:
-        """Decode supported ACE2 response payloads into logical response dicts."""
+        """
+        Decode an ACE2 response payload with the generated message decoder.
+
+        GET_INFO, commands without a schema, and payloads the generated
+        decoders reject go through the generic reference path (and so keep
+        ``raw_fields``). Generated GET_STATUS results are an
+        ``Ace2StatusResult`` without ``raw_fields``; ``include_raw_fields``
+        routes GET_STATUS through the reference path instead.
+        """
+        decoder = ACE2_RESPONSE_DECODERS.get(command_name)
+        if decoder is None or command_name == "GET_INFO":
+            return self._decode_response_payload_reference(command_name, payload)
+        if command_name == "GET_STATUS" and self.include_raw_fields:
+            return self._decode_response_payload_reference(command_name, payload)
+        try:
+            message = decoder(payload)
+        except (Ace2CodecFallback, IndexError):
+            return self._decode_response_payload_reference(command_name, payload)
+        if command_name == "GET_STATUS":
+            return {"code": 0, "msg": ACE2_RESPONSE_CODE_NAMES[0], "result": Ace2StatusResult(message)}
+        if command_name in ACE2_GENERIC_RESPONSE_COMMANDS:
+            code = message[0]
+            return {"code": code, "msg": ACE2_RESPONSE_CODE_NAMES.get(code, str(code))}
+        if command_name == "DISCOVER_DEVICE":
+            return {"uid1": message[0], "uid2": message[1], "uid3": message[2]}
+        if command_name == "GET_FILAMENT_INFO":
+            return self._build_filament_info_response(message)
+        return self._decode_response_payload_reference(command_name, payload)
+
+    @staticmethod
+    def _build_filament_info_response(message: tuple) -> dict[str, Any]:
+        """Assemble a GET_FILAMENT_INFO result from the generated tuple."""
+        (index, version, sku, filament_type, color_values, extruder, hotbed,
+         diameter, total, icon_type, current, code) = message
+        colors = []
+        for (rgba,) in color_values:
+            rgba = int(rgba)
+            colors.append([(rgba >> 24) & 0xFF, (rgba >> 16) & 0xFF, (rgba >> 8) & 0xFF, rgba & 0xFF])
+        return {
+            "code": code,
+            "msg": ACE2_RESPONSE_CODE_NAMES.get(code, str(code)),
+            "result": {
+                "index": index,
+                "version": version,
+                "sku": sku,
+                "type": filament_type,
+                "colors": colors,
+                "extruder_temp": {
+                    "min": extruder[0],
+                    "max": extruder[1],
+                    "min_speed": extruder[2],
+                    "max_speed": extruder[3],
+                },
+                "hotbed_temp": {"min": hotbed[0], "max": hotbed[1]},
+                "diameter": diameter,
+                "total": total,
+                "icon_type": icon_type,
+                "current": current,
+                "rfid": 2 if code == 0 else 0,
+            },
+        }
+
+    def _decode_response_payload_reference(self, command_name: str, payload: bytes) -> dict[str, Any]:
+        """Decode through the generic ``_pb_decode`` field dict (reference path)."""
         fields = _pb_decode(payload)
         if command_name == "DISCOVER_DEVICE":
             return {
@@ -522,75 +1086,66 @@ class AceProtoProtocolAdapter(AceProtocolAdapter):
         crc = struct.pack("<H", crc_calculator(bytes(inner)))
         return b"\xFF\xAA" + bytes(inner) + crc + b"\xFE"
 
-    def extract_responses(
+    FRAME_MIN_LENGTH = 10
+
+    def frame_length(self, buffer: bytearray, start: int) -> int:
+        """ACE2 frame: header(2) + flags + id(2) + cmd + len + payload + CRC(2) + tail."""
+        return 2 + 1 + 2 + 1 + 1 + buffer[start + 6] + 2 + 1
+
+    def decode_frame(
         self,
-        buffer: bytearray,
+        view: memoryview,
+        start: int,
+        frame_len: int,
         crc_calculator,
-    ) -> tuple[list[dict[str, Any]], bytearray, list[str]]:
-        """Parse ACE2 framed responses from a shared-bus serial buffer."""
-        responses: list[dict[str, Any]] = []
-        notices: list[str] = []
-        working = bytearray(buffer)
-
-        while True:
-            if len(working) < 10:
-                break
-
-            if not (working[0] == 0xFF and working[1] == 0xAA):
-                header_idx = working.find(bytes([0xFF, 0xAA]))
-                if header_idx == -1:
-                    notices.append(f"Resync: dropped junk ({len(working)} bytes)")
-                    working = bytearray()
-                    break
-                notices.append(f"Resync: skipping {header_idx} bytes")
-                working = working[header_idx:]
-                if len(working) < 10:
-                    break
-
-            payload_len = working[6]
-            frame_len = 2 + 1 + 2 + 1 + 1 + payload_len + 2 + 1
-            if len(working) < frame_len:
-                break
-
-            terminator_idx = 2 + 1 + 2 + 1 + 1 + payload_len + 2
-            if working[terminator_idx] != 0xFE:
-                next_header = working.find(bytes([0xFF, 0xAA]), 1)
-                working = bytearray() if next_header == -1 else working[next_header:]
-                notices.append("Invalid frame tail, resyncing")
-                continue
-
-            frame = bytes(working[:frame_len])
-            working = bytearray(working[frame_len:])
-
-            flags = frame[2]
-            request_id = frame[3] | (frame[4] << 8)
-            command_code = frame[5]
-            payload = frame[7:7 + payload_len]
-            crc_rx = frame[7 + payload_len:7 + payload_len + 2]
-            crc_calc = struct.pack("<H", crc_calculator(frame[2:7 + payload_len]))
-            if crc_rx != crc_calc:
-                notices.append("Invalid CRC")
-                continue
-
-            command_spec = ACE2_COMMANDS_BY_CODE.get(command_code)
-            command_name = command_spec.name if command_spec else f"CMD_{command_code}"
-            decoded = self._decode_response_payload(command_name, payload)
-            response = {"id": request_id, "command": command_name, "flags": flags}
-            device_id = flags & ACE2_FLAG_DEVICE_ID_MASK
-            if device_id:
-                response["device_id"] = device_id
-            if command_name == "DISCOVER_DEVICE":
-                response["result"] = decoded
-            else:
-                response.update(decoded)
-            responses.append(response)
-
-        return responses, working, notices
+    ) -> tuple[dict[str, Any] | None, str | None]:
+        """Check the CRC of one ACE2 frame and decode its protobuf payload."""
+        crc_start = start + frame_len - 3
+        crc_rx = view[crc_start] | (view[crc_start + 1] << 8)
+        if crc_rx != crc_calculator(view[start + 2:crc_start]):
+            return None, "Invalid CRC"
+
+        flags = view[start + 2]
+        request_id = view[start + 3] | (view[start + 4] << 8)
+        command_code = view[start + 5]
+        payload = bytes(view[start + 7:crc_start])
+
+        command_spec = ACE2_COMMANDS_BY_CODE.get(command_code)
+        command_name = command_spec.name if command_spec else f"CMD_{command_code}"
+        decoded = self._decode_response_payload(command_name, payload)
+        response = {"id": request_id, "command": command_name, "flags": flags}
+        device_id = flags & ACE2_FLAG_DEVICE_ID_MASK
+        if device_id:
+            response["device_id"] = device_id
+        if command_name == "DISCOVER_DEVICE":
+            response["result"] = decoded
+        else:
+            response.update(decoded)
+        return response, None
 
     def get_command_catalog(self) -> Tuple[AceCommandSpec, ...]:
         """Return the proto-derived ACE2 command catalog."""
         return ACE2_COMMAND_CATALOG
 
+    def get_request_timeout_hint(self, request: Mapping[str, Any]) -> float | None:
+        """Return the catalog timeout hint for an ACE2 request."""
+        spec = ACE2_COMMANDS_BY_NAME.get(request.get("command"))
+        return spec.timeout_s if spec is not None else None
+
+    def get_request_flow_key(self, request: Mapping[str, Any]) -> Any:
+        """Each addressed bus device is its own flow; discovery/assignment share None."""
+        return request.get("target_device_id")
+
+    def get_coalesce_key(self, request: Mapping[str, Any]) -> tuple | None:
+        """Status/info reads to the same bus device (and slot) are safe to share."""
+        command = request.get("command")
+        if command not in ACE2_COALESCIBLE_COMMANDS:
+            return None
+        params = request.get("params") or {}
+        if set(params) - {"index"}:
+            return None
+        return (command, request.get("target_device_id"), params.get("index"))
+
     def normalize_request(self, request: Dict[str, Any]) -> Dict[str, Any]:
         """Return a copy of the logical ACE2 request until binary framing is added."""
         return deepcopy(request)
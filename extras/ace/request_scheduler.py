@@ -0,0 +1,218 @@
+"""Priority scheduler for requests waiting for a window slot."""
+
+from __future__ import annotations
+
+import heapq
+import itertools
+import threading
+import time
+from typing import Any, Callable, Dict, List, Optional, Tuple
+
+
+class AceQueueStats:
+    """Queue wait-time statistics for one priority class."""
+
+    __slots__ = ("dequeued", "dropped_stale", "total_wait", "max_wait", "last_wait")
+
+    def __init__(self):
+        self.dequeued = 0
+        self.dropped_stale = 0
+        self.total_wait = 0.0
+        self.max_wait = 0.0
+        self.last_wait = 0.0
+
+    def record(self, wait: float) -> None:
+        self.dequeued += 1
+        self.total_wait += wait
+        self.last_wait = wait
+        if wait > self.max_wait:
+            self.max_wait = wait
+
+    def snapshot(self) -> Dict[str, float]:
+        return {
+            "dequeued": self.dequeued,
+            "dropped_stale": self.dropped_stale,
+            "avg_wait_s": self.total_wait / self.dequeued if self.dequeued else 0.0,
+            "max_wait_s": self.max_wait,
+            "last_wait_s": self.last_wait,
+        }
+
+
+class AceRequestScheduler:
+    """
+    Pending requests ordered by priority class and age, fair across devices.
+
+    Each entry is ranked by ``enqueue_time + AGING_OFFSETS[priority]``, so a
+    high-priority request normally goes first but a normal request that has
+    waited longer than the offset difference overtakes newly queued
+    high-priority ones (the heartbeat cannot starve feed/unwind commands).
+
+    Entries are kept in one heap per flow. A flow is the ACE2 target device
+    on a shared bus (protocol ``get_request_flow_key``); everything else is
+    the single ``None`` flow. pop() serves flows round-robin, first among
+    flows whose head is urgent (rank already reached: high priority, or an
+    aged normal request), then among the rest. Flows the caller reports as
+    ``capped`` (device in-flight limit reached) are skipped while any other
+    flow has work, so one unit's speed updates cannot hold every window slot
+    while another unit's heartbeat waits.
+
+    An entry may carry ``max_wait``: if it reaches the head of its flow
+    after waiting longer than that, it is dropped instead of sent and
+    returned to the caller as stale. Status polls use this so a poll that
+    sat behind a backlog is not sent after the next one is already due.
+
+    push/pop/clear take one lock each; push is O(log n), pop O(flows + log n).
+    """
+
+    HIGH = 0
+    NORMAL = 1
+    PRIORITY_NAMES = {HIGH: "high", NORMAL: "normal"}
+    AGING_OFFSETS = {HIGH: 0.0, NORMAL: 2.0}
+
+    def __init__(self, maxsize: int = 1024, clock: Callable[[], float] = time.monotonic,
+                 wait_observer: Optional[Callable[[float], None]] = None):
+        self.maxsize = int(maxsize)
+        self._clock = clock
+        self._wait_observer = wait_observer  # called with each dequeued request's wait
+        self._flows: Dict[Any, List[list]] = {}
+        self._ring: List[Any] = []  # flow keys in round-robin order
+        self._rr_next = 0
+        self._size = 0
+        self._seq = itertools.count()
+        self._counts = {self.HIGH: 0, self.NORMAL: 0}
+        self._stats = {prio: AceQueueStats() for prio in self.PRIORITY_NAMES}
+        self._flow_dispatched: Dict[Any, int] = {}
+        self._peak_depth = 0
+        self._rejected = 0
+        self._lock = threading.Lock()
+
+    def __len__(self) -> int:
+        return self._size
+
+    def qsize(self, priority: Optional[int] = None) -> int:
+        """Number of queued entries, optionally for one priority class."""
+        if priority is None:
+            return self._size
+        return self._counts.get(priority, 0)
+
+    def push(self, request: Any, callback: Any, priority: int = NORMAL,
+             max_wait: Optional[float] = None, flow: Any = None) -> bool:
+        """Queue a request; False if the scheduler is full."""
+        now = self._clock()
+        rank = now + self.AGING_OFFSETS[priority]
+        stale_at = now + max_wait if max_wait is not None else None
+        with self._lock:
+            if self._size >= self.maxsize:
+                self._rejected += 1
+                return False
+            heap = self._flows.get(flow)
+            if heap is None:
+                heap = self._flows[flow] = []
+                self._ring.append(flow)
+                self._flow_dispatched.setdefault(flow, 0)
+            heapq.heappush(
+                heap,
+                [rank, next(self._seq), priority, now, stale_at, request, callback],
+            )
+            self._counts[priority] += 1
+            self._size += 1
+            if self._size > self._peak_depth:
+                self._peak_depth = self._size
+        return True
+
+    def _pop_entry(self, heap: List[list]) -> list:
+        entry = heapq.heappop(heap)
+        self._counts[entry[2]] -= 1
+        self._size -= 1
+        return entry
+
+    def _drop_stale_heads(self, heap: List[list], now: float, stale: list) -> None:
+        while heap and heap[0][4] is not None and now > heap[0][4]:
+            entry = self._pop_entry(heap)
+            self._stats[entry[2]].dropped_stale += 1
+            stale.append((entry[5], entry[6]))
+
+    def _select_flow(self, now: float, capped, stale: list) -> Optional[int]:
+        """Ring index of the flow to serve next, or None if nothing is queued."""
+        ring_len = len(self._ring)
+        urgent = open_flow = urgent_capped = any_flow = None
+        for offset in range(ring_len):
+            index = (self._rr_next + offset) % ring_len
+            heap = self._flows[self._ring[index]]
+            self._drop_stale_heads(heap, now, stale)
+            if not heap:
+                continue
+            is_urgent = heap[0][0] <= now
+            if self._ring[index] in capped:
+                if is_urgent and urgent_capped is None:
+                    urgent_capped = index
+                if any_flow is None:
+                    any_flow = index
+                continue
+            if is_urgent:
+                urgent = index
+                break
+            if open_flow is None:
+                open_flow = index
+        for index in (urgent, open_flow, urgent_capped, any_flow):
+            if index is not None:
+                return index
+        return None
+
+    def pop(self, capped=()) -> Tuple[Tuple[Any, Any], List[Tuple[Any, Any]]]:
+        """
+        Remove the next request to send.
+
+        Args:
+            capped: Flow keys at their in-flight limit; served only when no
+                other flow has queued work
+
+        Returns:
+            ((request, callback) or (None, None), stale) where ``stale`` lists
+            (request, callback) pairs dropped for exceeding max_wait. The
+            caller must complete stale callbacks outside of any lock.
+        """
+        stale = []
+        now = self._clock()
+        with self._lock:
+            index = self._select_flow(now, capped, stale)
+            if index is None:
+                return (None, None), stale
+            flow = self._ring[index]
+            entry = self._pop_entry(self._flows[flow])
+            self._rr_next = (index + 1) % len(self._ring)
+            self._flow_dispatched[flow] += 1
+            wait = now - entry[3]
+            self._stats[entry[2]].record(wait)
+            if self._wait_observer is not None:
+                self._wait_observer(wait)
+            return (entry[5], entry[6]), stale
+
+    def clear(self) -> List[Tuple[Any, Any]]:
+        """Drop every queued request and return them in rank order."""
+        with self._lock:
+            entries = sorted(entry for heap in self._flows.values() for entry in heap)
+            for heap in self._flows.values():
+                heap.clear()
+            self._size = 0
+            for prio in self._counts:
+                self._counts[prio] = 0
+        return [(entry[5], entry[6]) for entry in entries]
+
+    def snapshot(self) -> Dict[str, Any]:
+        """Return depth, per-flow and wait-time statistics for status reporting."""
+        with self._lock:
+            result = {
+                "depth": self._size,
+                "peak_depth": self._peak_depth,
+                "rejected": self._rejected,
+            }
+            for prio, name in self.PRIORITY_NAMES.items():
+                stats = self._stats[prio].snapshot()
+                stats["queued"] = self._counts[prio]
+                result[name] = stats
+            result["flows"] = {
+                flow: {"queued": len(self._flows[flow]), "dispatched": self._flow_dispatched[flow]}
+                for flow in self._ring
+            }
+        return result
@@ -0,0 +1,106 @@
+"""Per-command round-trip estimation for ACE request timeouts."""
+
+from __future__ import annotations
+
+from dataclasses import dataclass
+from typing import Dict
+
+
+@dataclass
+class AceRttStats:
+    """Smoothed round-trip statistics for one command class."""
+
+    srtt: float = 0.0
+    rttvar: float = 0.0
+    samples: int = 0
+    timeouts: int = 0
+    backoff: float = 1.0
+    last_rtt: float = 0.0
+
+
+class AceRttEstimator:
+    """
+    Derive request timeouts from observed round-trip times.
+
+    Uses the classic smoothed RTT / RTT variance estimator (RTO = SRTT +
+    4 * RTTVAR) per command class. Until MIN_SAMPLES responses have been
+    seen for a class, the protocol hint (or the default) is used as-is.
+    When disabled every class gets the default; hints are ignored.
+    A timeout doubles that class's timeout until the next good sample, so a
+    command that is genuinely slower than its history is not cut off
+    repeatedly.
+    """
+
+    ALPHA = 0.125
+    BETA = 0.25
+    VAR_MULTIPLIER = 4.0
+    MIN_SAMPLES = 4
+    MIN_TIMEOUT_S = 0.5
+    MAX_TIMEOUT_S = 30.0
+    MAX_BACKOFF = 8.0
+
+    def __init__(self, default_timeout_s: float, enabled: bool = True):
+        self.default_timeout_s = float(default_timeout_s)
+        self.enabled = bool(enabled)
+        self._stats: Dict[str, AceRttStats] = {}
+
+    def _get_stats(self, key: str) -> AceRttStats:
+        stats = self._stats.get(key)
+        if stats is None:
+            stats = AceRttStats()
+            self._stats[key] = stats
+        return stats
+
+    def observe(self, key: str | None, rtt: float) -> None:
+        """Record one round-trip sample for a command class."""
+        if key is None or rtt < 0:
+            return
+        stats = self._get_stats(key)
+        if stats.samples == 0:
+            stats.srtt = rtt
+            stats.rttvar = rtt / 2.0
+        else:
+            stats.rttvar = (1.0 - self.BETA) * stats.rttvar + self.BETA * abs(stats.srtt - rtt)
+            stats.srtt = (1.0 - self.ALPHA) * stats.srtt + self.ALPHA * rtt
+        stats.samples += 1
+        stats.last_rtt = rtt
+        stats.backoff = 1.0
+
+    def on_timeout(self, key: str | None) -> None:
+        """Record a timeout and back off the next timeout for this class."""
+        if key is None:
+            return
+        stats = self._get_stats(key)
+        stats.timeouts += 1
+        stats.backoff = min(stats.backoff * 2.0, self.MAX_BACKOFF)
+
+    def timeout_for(self, key: str | None, hint: float | None = None) -> float:
+        """Return the timeout to apply to the next request of this class."""
+        if not self.enabled:
+            return self.default_timeout_s
+        seed = float(hint) if hint else self.default_timeout_s
+        if key is None:
+            return seed
+
+        stats = self._stats.get(key)
+        if stats is None:
+            return seed
+        if stats.samples < self.MIN_SAMPLES:
+            return min(seed * stats.backoff, self.MAX_TIMEOUT_S)
+
+        rto = stats.srtt + self.VAR_MULTIPLIER * stats.rttvar
+        rto = max(self.MIN_TIMEOUT_S, rto) * stats.backoff
+        return min(rto, self.MAX_TIMEOUT_S)
+
+    def snapshot(self) -> Dict[str, Dict[str, float]]:
+        """Return per-class statistics for status reporting."""
+        result = {}
+        for key, stats in self._stats.items():
+            result[key] = {
+                "srtt": stats.srtt,
+                "rttvar": stats.rttvar,
+                "samples": stats.samples,
+                "timeouts": stats.timeouts,
+                "timeout_s": self.timeout_for(key),
+            }
+        return result
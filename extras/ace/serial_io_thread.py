@@ -0,0 +1,226 @@
+"""Serial I/O on a dedicated thread, handing parsed frames to the reactor."""
+
+from __future__ import annotations
+
+import collections
+import logging
+import os
+import select
+import threading
+from typing import Any, Callable, Deque, Optional, Tuple
+
+
+class AceSerialIoThread:
+    """
+    Blocking serial reads/writes and frame parsing off the reactor thread.
+
+    The reactor thread keeps every piece of request bookkeeping (ids,
+    in-flight window, callbacks, timeouts); this thread only touches the
+    port, its own frame parser and two deques:
+
+    - tx: ``(request_id, frame bytes)`` appended by the reactor, popped here
+    - rx: ``(kind, payload, request_id)`` events appended here, popped by
+      the reactor: ``("response", dict)``, ``("notice", str)``,
+      ``("write_error", exception, request_id)``, ``("read_error", exception)``
+
+    Each deque has exactly one producer and one consumer, and
+    ``deque.append``/``popleft`` are atomic, so the handoff itself takes no
+    lock. (The manager's own bookkeeping still runs under its reactor-only
+    ``_lock``, as in the fd and timer modes; that lock is never contended by
+    this thread.) The reactor is woken through ``wake()``
+    (``reactor.register_async_callback``) at most once per batch; the thread
+    is woken for writes through a pipe that it selects on together with the
+    port.
+
+    A stalled USB CDC endpoint therefore blocks this thread's ``write()``
+    instead of klippy's reactor. For the same reason ``stop()`` does not
+    join: once started, the thread owns the port and closes it on the way
+    out, so the reactor never waits on a stalled write.
+    """
+
+    SELECT_TIMEOUT = 0.5  # upper bound on noticing stop() without a wake
+    READ_SIZE = 4096
+
+    def __init__(self, port, parser, wake: Callable[[], None], name: str = "ace-serial-io"):
+        self.port = port
+        self.parser = parser
+        self._wake = wake
+        self.name = name
+        self.tx: Deque[Tuple[Any, bytes]] = collections.deque()
+        self.rx: Deque[tuple] = collections.deque()
+        self._rx_wake_pending = threading.Event()
+        self._stop = threading.Event()
+        self._thread: Optional[threading.Thread] = None
+        self._wake_r = self._wake_w = None
+        self._release_lock = threading.Lock()
+        self._released = False
+        self.frames_written = 0
+        self.frames_read = 0
+        self.bytes_read = 0
+        self.reactor_wakeups = 0
+        self.recorder = None  # AceWireRecorder; raw chunks are captured as read/written
+        self.metrics = None  # AceTransportMetrics; tx is counted once a write succeeds
+
+    @property
+    def running(self) -> bool:
+        return self._thread is not None and self._thread.is_alive()
+
+    def start(self) -> None:
+        self._wake_r, self._wake_w = os.pipe()
+        os.set_blocking(self._wake_r, False)
+        self._stop.clear()
+        self._thread = threading.Thread(target=self._run, name=self.name, daemon=True)
+        self._thread.start()
+
+    def stop(self) -> None:
+        """
+        Ask the thread to exit without waiting for it.
+
+        The thread closes the port on its way out; if it never ran or has
+        already exited, this call closes it instead. Callers must not touch
+        the port afterwards; ``join()`` reaps the thread and its wake pipe.
+        """
+        self._stop.set()
+        self._poke()
+        if not self.running:
+            self._release()
+            self._close_wake_pipe()
+
+    def join(self, timeout: Optional[float] = 0.0) -> bool:
+        """
+        Reap a stopped thread; True once it has exited.
+
+        The default timeout only polls, so the reactor can call this from a
+        timer until the thread is gone.
+        """
+        thread = self._thread
+        if thread is not None and thread is not threading.current_thread():
+            thread.join(timeout)
+        if self.running:
+            return False
+        self._close_wake_pipe()
+        return True
+
+    # ---- reactor side ----
+
+    def send(self, request_id, data: bytes) -> None:
+        """Queue one encoded frame for writing (reactor thread)."""
+        self.tx.append((request_id, data))
+        self._poke()
+
+    def acknowledge_wake(self) -> None:
+        """Reactor thread: called before draining rx so new events wake it again."""
+        self._rx_wake_pending.clear()
+
+    # ---- I/O thread ----
+
+    def _poke(self) -> None:
+        fd = self._wake_w
+        if fd is not None:
+            try:
+                os.write(fd, b".")
+            except OSError:
+                pass  # pipe full: a wake is already pending
+
+    def _emit(self, *event) -> None:
+        self.rx.append(event)
+        if not self._rx_wake_pending.is_set():
+            self._rx_wake_pending.set()
+            self.reactor_wakeups += 1
+            self._wake()
+
+    def _release(self) -> None:
+        """Close the port exactly once, from whichever side gets here first."""
+        with self._release_lock:
+            if self._released:
+                return
+            self._released = True
+        try:
+            self.port.close()
+        except Exception as e:
+            logging.warning(f"{self.name}: error closing port: {e}")
+
+    def _close_wake_pipe(self) -> None:
+        """Reactor side, once the thread has exited: nothing selects on it."""
+        for fd in (self._wake_r, self._wake_w):
+            if fd is not None:
+                try:
+                    os.close(fd)
+                except OSError:
+                    pass
+        self._wake_r = self._wake_w = None
+
+    def _drain_wake_pipe(self) -> None:
+        try:
+            while os.read(self._wake_r, 512):
+                pass
+        except (BlockingIOError, OSError):
+            pass
+
+    def _write_pending(self) -> None:
+        while self.tx and not self._stop.is_set():
+            request_id, data = self.tx.popleft()
+            try:
+                self.port.write(data)
+            except Exception as e:
+                self._emit("write_error", e, request_id)
+                continue
+            self.frames_written += 1
+            # Only this thread updates the tx counters in thread mode
+            if self.metrics is not None:
+                self.metrics.record_tx(len(data))
+            if self.recorder is not None:
+                self.recorder.record_tx(data)
+
+    def _read_available(self) -> bool:
+        try:
+            raw = self.port.read(size=self.READ_SIZE)
+        except Exception as e:
+            self._emit("read_error", e)
+            return False
+        if raw:
+            self.bytes_read += len(raw)
+            if self.recorder is not None:
+                self.recorder.record_rx(raw)
+            self.parser.append(raw)
+            while len(self.parser):
+                try:
+                    responses, notices = self.parser.parse()
+                except Exception as e:
+                    self._emit("read_error", e)
+                    return False
+                for notice in notices:
+                    self._emit("notice", notice)
+                if not responses:
+                    break
+                for response in responses:
+                    self.frames_read += 1
+                    self._emit("response", response)
+        return True
+
+    def _run(self) -> None:
+        try:
+            self._serve()
+        finally:
+            self._release()
+
+    def _serve(self) -> None:
+        try:
+            port_fd = self.port.fileno()
+        except Exception as e:
+            self._emit("read_error", e)
+            return
+        wake_r = self._wake_r
+        while not self._stop.is_set():
+            self._write_pending()
+            try:
+                readable, _, _ = select.select([port_fd, wake_r], [], [], self.SELECT_TIMEOUT)
+            except (OSError, ValueError) as e:
+                if not self._stop.is_set():
+                    self._emit("read_error", e)
+                return
+            if wake_r in readable:
+                self._drain_wake_pipe()
+            if port_fd in readable and not self._stop.is_set():
+                if not self._read_available():
+                    return
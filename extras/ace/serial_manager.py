@@ -11,16 +11,67 @@ Responsibilities:
 
 import serial
 import json
+import os
 import threading
-import queue
 import logging
 import traceback
-import re
+from copy import deepcopy
 from serial import SerialException
 import serial.tools.list_ports
 
-from .protocol import transport_description_matches
+from .crc import crc16_mcrf4xx
+from .heartbeat_policy import AceHeartbeatPolicy
+from .hotplug import AceHotplugWatcher
+from .port_inventory import AcePortInventory
+from .serial_io_thread import AceSerialIoThread
+from .status_delta import AceStatusDelta
+from .protocol import AceFrameParser, transport_description_matches
 from .protocol_ace1 import AceJsonProtocolAdapter
+from .request_scheduler import AceRequestScheduler
+from .rtt_estimator import AceRttEstimator
+from .transport_metrics import AceTransportMetrics
+from .tx_pacer import AceTxPacer
+
+
+class CoalescedRequest:
+    """
+    Callback fan-out for one idempotent read shared by several callers.
+
+    Queued in place of the first caller's callback; later identical reads
+    append to ``callbacks`` instead of taking another window slot. The
+    single response (or timeout) is delivered to every waiting callback.
+    """
+
+    __slots__ = ("manager", "key", "high_prio", "sent", "callbacks")
+
+    def __init__(self, manager, key, high_prio):
+        self.manager = manager
+        self.key = key
+        self.high_prio = high_prio
+        self.sent = False
+        self.callbacks = []
+
+    def claim(self):
+        """Mark as sent; False if another queue entry already sent it."""
+        if self.sent:
+            return False
+        self.sent = True
+        return True
+
+    def __call__(self, response=None):
+        self.manager._release_coalesced(self)
+        # Copy before any callback runs so one waiter cannot mutate another's view
+        responses = [response] + [
+            deepcopy(response) if response is not None else None
+            for _ in self.callbacks[1:]
+        ]
+        for callback, waiter_response in zip(self.callbacks, responses):
+            try:
+                callback(response=waiter_response)
+            except Exception as e:
+                self.manager.gcode.respond_info(
+                    f"ACE[{self.manager.instance_num}]: Callback error: {e}"
+                )
 
 
 class AceSerialManager:
@@ -28,7 +79,16 @@ class AceSerialManager:
 
     QUEUE_MAXSIZE = 1024
     WINDOW_SIZE = 4
+    DEVICE_WINDOW_SIZE = 2  # per bus device while other devices have work queued
     DEFAULT_TIMEOUT_S = 5.0
+    LATE_REPLY_WINDOW_S = 30.0  # how long a reply after an adaptive timeout is still recognised
+    READER_POLL_INTERVAL = 0.05
+    READER_MODES = ("fd", "timer", "thread")
+    IO_THREAD_REAP_INTERVAL = 1.0  # poll stopped I/O threads; warn if one is still stuck
+    HOTPLUG_SETTLE_S = 0.5  # let udev finish the node/permissions before opening
+    HOTPLUG_MAX_RETRIES = 3  # quick retries after a device event before normal backoff
+    STARTUP_PROBE_INTERVAL = 0.25  # re-check for the device node while it enumerates
+    STARTUP_PROBE_MAX_AGE = 0.2  # port snapshot reused by instances probing in the same tick
 
     def __init__(
             self,
@@ -38,7 +98,15 @@ class AceSerialManager:
             ace_enabled=True,
             status_debug_logging=False,
             supervision_enabled=True,
-            protocol=None):
+            protocol=None,
+            reader_mode="fd",
+            adaptive_timeouts=True,
+            tx_rate_limit=None,
+            tx_burst_bytes=None,
+            hotplug=False,
+            port_inventory=None,
+            heartbeat_policy=None,
+            wire_recorder=None):
         """
         Initialize serial manager.
 
@@ -49,6 +117,22 @@ class AceSerialManager:
             ace_enabled: Initial ACE Pro enabled state
             status_debug_logging: Enable detailed status logging for debugging
             supervision_enabled: Enable communication health supervision
+            reader_mode: "fd" to read when the port becomes readable,
+                "timer" to poll the port every READER_POLL_INTERVAL,
+                "thread" to do port I/O and parsing on an AceSerialIoThread
+            adaptive_timeouts: Derive per-command timeouts from measured
+                round-trip times instead of always using timeout_s
+            tx_rate_limit: Byte budget refill rate for outgoing frames in
+                bytes/s; None uses the protocol default, 0 disables pacing
+            tx_burst_bytes: Byte budget size; None uses the protocol default
+            hotplug: Watch /dev for serial devices appearing and retry the
+                connection immediately instead of waiting for the backoff
+            port_inventory: AcePortInventory shared with other instances;
+                a private one is created if omitted
+            heartbeat_policy: AceHeartbeatPolicy choosing the status poll
+                interval; a fixed 1 s policy is used if omitted
+            wire_recorder: AceWireRecorder capturing every frame written and
+                every chunk read; None disables capture
         """
         self._port = None
         self._usb_location = None
@@ -69,20 +153,46 @@ class AceSerialManager:
         self._request_id = 0
         self._callback_map = {}
         self.inflight = {}
+        self._coalesced = {}  # coalesce key -> CoalescedRequest queued or in flight
+        self._coalesced_requests = 0
+        self._inflight_timeouts = {}  # rid -> timeout applied to that request
+        self._inflight_commands = {}  # rid -> command class for RTT sampling
+        self._inflight_flows = {}  # rid -> scheduler flow (ACE2 bus device)
+        self._inflight_shortened = set()  # rids whose adaptive timeout is below the fixed one
+        self._expired_early = {}  # rid -> (send time, command) cut off by an adaptive timeout
+
+        self.metrics = AceTransportMetrics(self.WINDOW_SIZE)
+        self._scheduler = AceRequestScheduler(
+            maxsize=self.QUEUE_MAXSIZE,
+            clock=self.reactor.monotonic,
+            wait_observer=self.metrics.record_queue_wait,
+        )
 
-        self._hp_queue = queue.Queue(maxsize=self.QUEUE_MAXSIZE)
-        self._queue = queue.Queue(maxsize=self.QUEUE_MAXSIZE)
-
-        self.read_buffer = bytearray()
+        self._frame_parser = None
         self.send_time = None
 
         self.writer_timer = None
+        self.deadline_timer = None
+        self._next_deadline = None
         self.reader_timer = None
+        self.reader_fd_handle = None
+        self._io_thread = None
+        self._io_bytes_seen = 0
+        self._retired_io_threads = []  # stopped, not yet exited: [thread, stopped_at, warned]
+        self._io_reaper_timer = None
+        self.wire_recorder = wire_recorder
         self.heartbeat_timer = None
         self.connect_timer = None
 
+        # Reader wakeup accounting for comparing fd-driven and polled reads
+        self.reader_mode = reader_mode if reader_mode in self.READER_MODES else "fd"
+        self._reader_wakeups = 0
+        self._reader_empty_wakeups = 0
+        self._input_dispatch_active = False
+
         self._last_status_request_time = 0
-        self.heartbeat_interval = 1.0
+        self.heartbeat_policy = heartbeat_policy or AceHeartbeatPolicy(1.0, adaptive=False)
+        self._next_heartbeat = None
         self.heartbeat_callback = None
         self.on_connect_callback = None
         self.on_connect_callbacks = []
@@ -90,11 +200,34 @@ class AceSerialManager:
 
         self.timeout_s = self.DEFAULT_TIMEOUT_S
         self.timeout_multiplier = 2
+        self.rtt_estimator = AceRttEstimator(self.DEFAULT_TIMEOUT_S, enabled=adaptive_timeouts)
+        transport = self.protocol.get_transport_spec()
+        self.tx_pacer = AceTxPacer(
+            transport.tx_rate_bytes_s if tx_rate_limit is None else tx_rate_limit,
+            transport.tx_burst_bytes if tx_burst_bytes is None else tx_burst_bytes,
+        )
+        self._paced_frame = None  # (request, callback, frame, held since) waiting for budget
+
+        # Resolve comports at call time so a patched serial module is honoured
+        self.port_inventory = port_inventory or AcePortInventory(
+            lambda: serial.tools.list_ports.comports(),
+            clock=lambda: self.reactor.monotonic(),
+        )
+        self.startup_timeline = None  # AceStartupTimeline set by the manager at klippy:ready
+        self.startup_units = None  # instance numbers on this transport; None = just this one
+        self.hotplug_enabled = bool(hotplug)
+        self.hotplug_watcher = None
+        self._hotplug_retries = 0      # quick retries left after a device event
+        self._reconnect_trigger = "backoff"
+        self._disconnected_at = None   # monotonic time the link was lost
+        self._last_reconnect_duration = None
+        self._last_reconnect_trigger = None
 
         self.last_status = None
         self.last_action = None
         self.last_slot_states = {}
         self.last_slot_payloads = {}
+        self._debug_status_delta = AceStatusDelta()
         self.last_dryer_status = None
         self.last_temp = None
         self.last_feed_assist_count = None
@@ -102,6 +235,9 @@ class AceSerialManager:
 
         self._ace_pro_enabled = ace_enabled
         self._status_debug_logging = bool(status_debug_logging)
+        if self._status_debug_logging and hasattr(self.protocol, "include_raw_fields"):
+            # The status debug log prints the raw protobuf fields (ACE2)
+            self.protocol.include_raw_fields = True
         self._supervision_enabled = bool(supervision_enabled)
         # Human-readable connection state for KlipperScreen UI
         self.connection_state = "disabled" if not ace_enabled else "initializing"
@@ -218,22 +354,12 @@ class AceSerialManager:
         """
         matches = []
 
-        for portinfo in serial.tools.list_ports.comports():
+        for portinfo in self.port_inventory.ports():
             if not transport_description_matches(device_name, portinfo.description):
                 continue
 
-            # Extract USB location from hwid
-            location = None
-            m = re.search(r'LOCATION=([-\w\.]+)', portinfo.hwid)
-            if m:
-                location = m.group(1)
-            else:
-                # Fallback: extract ACM number
-                m2 = re.search(r'ACM(\d+)', portinfo.device)
-                if m2:
-                    location = f"acm.{m2.group(1)}"
-                else:
-                    location = portinfo.device
+            # USB location from hwid, falling back to the ACM number
+            location = portinfo.location
 
             sort_key = self._parse_usb_location(location)
             matches.append((sort_key, location, portinfo.device))
@@ -300,24 +426,13 @@ class AceSerialManager:
 
     def _get_usb_location_for_port(self, port):
         """Get USB location string for a specific port."""
-        for portinfo in serial.tools.list_ports.comports():
-            if portinfo.device == port:
-                m = re.search(r'LOCATION=([-\w\.]+)', portinfo.hwid)
-                if m:
-                    return m.group(1)
-                # Fallback
-                m2 = re.search(r'ACM(\d+)', portinfo.device)
-                if m2:
-                    return f"acm.{m2.group(1)}"
-                return portinfo.device
-        return None
+        portinfo = self.port_inventory.find(port)
+        return portinfo.location if portinfo is not None else None
 
     def _get_port_description_for_port(self, port):
         """Get human-readable USB port description for a specific port."""
-        for portinfo in serial.tools.list_ports.comports():
-            if portinfo.device == port:
-                return str(portinfo.description or "")
-        return None
+        portinfo = self.port_inventory.find(port)
+        return portinfo.description if portinfo is not None else None
 
     def get_usb_location(self):
         """Get current USB location."""
@@ -403,7 +518,14 @@ class AceSerialManager:
     # ========== Serial Connection Management ==========
 
     def connect_to_ace(self, baud, delay=2):
-        """Start connection attempts (only if ACE enabled)."""
+        """
+        Start connection attempts (only if ACE enabled).
+
+        The first attempt runs immediately. If the device has not enumerated
+        yet, it is re-probed every STARTUP_PROBE_INTERVAL for up to ``delay``
+        seconds without counting as failed attempts; after that the normal
+        retry backoff applies.
+        """
         if not self._ace_pro_enabled:
             self.gcode.respond_info(
                 f'ACE[{self.instance_num}]: ACE Pro disabled - '
@@ -412,19 +534,30 @@ class AceSerialManager:
             return
 
         self._baud = baud
+        self._start_hotplug_watcher()
+        probe_until = self.reactor.monotonic() + delay
 
         def connect_callback(eventtime):
+            nonlocal probe_until
             if not self._ace_pro_enabled:
                 self.gcode.respond_info(
                     f'ACE[{self.instance_num}]: ACE Pro disabled during connection attempt'
                 )
                 return self.reactor.NEVER
 
+            if probe_until is not None:
+                if eventtime < probe_until and not self._device_enumerated():
+                    return eventtime + self.STARTUP_PROBE_INTERVAL
+                probe_until = None
+
             if self.auto_connect(self.instance_num, self._baud):
                 logging.info(f'ACE[{self.instance_num}]: Connected')
                 # Reset backoff on successful connect
                 self._reconnect_backoff = self.RECONNECT_BACKOFF_MIN
+                self._hotplug_retries = 0
                 return self.reactor.NEVER
+            elif self._consume_hotplug_retry():
+                return eventtime + self.HOTPLUG_SETTLE_S * 2
             else:
                 # Track failed connection attempt for stability detection
                 # (only track failures, not the initial attempt)
@@ -450,14 +583,36 @@ class AceSerialManager:
                 )
                 return eventtime + current_backoff
 
-        initial_delay = self._reconnect_backoff
         logging.info(
-            f'ACE[{self.instance_num}]: Starting connection (first attempt in {initial_delay:.0f}s)'
+            f'ACE[{self.instance_num}]: Starting connection (probing for device up to {delay:.1f}s)'
         )
-        self.connect_timer = self.reactor.register_timer(
-            connect_callback,
-            self.reactor.monotonic() + initial_delay
+        self.connect_timer = self.reactor.register_timer(connect_callback, self.reactor.NOW)
+
+    def _device_enumerated(self):
+        """
+        Cheap readiness probe: has the OS enumerated enough matching ports?
+
+        Unlike find_com_port this has no side effects (no topology capture,
+        no warnings). Without a hot-plug watcher to invalidate the shared
+        port snapshot, a probe re-enumerates unless another instance already
+        did so within this probe tick.
+        """
+        if self.hotplug_watcher is None or not self.hotplug_watcher.active:
+            self.port_inventory.expire(self.STARTUP_PROBE_MAX_AGE, "startup probe")
+        transport = self.protocol.get_transport_spec()
+        needed = 1 if transport.shared_bus else self.instance_num + 1
+        found = sum(
+            1 for portinfo in self.port_inventory.ports()
+            if transport_description_matches(transport.port_description, portinfo.description)
         )
+        return found >= needed
+
+    def _mark_startup(self, phase):
+        """Record a startup phase for every unit on this transport if a timeline is active."""
+        if self.startup_timeline is None:
+            return
+        for unit in self.startup_units or (self.instance_num,):
+            self.startup_timeline.mark(unit, phase)
 
     def reconnect(self, delay=None):
         """Disconnect and schedule reconnection (only if ACE enabled)."""
@@ -495,7 +650,10 @@ class AceSerialManager:
                 self.gcode.respond_info(f'ACE[{self.instance_num}]: Connected')
                 # Reset backoff on successful connect
                 self._reconnect_backoff = self.RECONNECT_BACKOFF_MIN
+                self._hotplug_retries = 0
                 return self.reactor.NEVER
+            elif self._consume_hotplug_retry():
+                return eventtime + self.HOTPLUG_SETTLE_S * 2
             else:
                 # Track failed connection attempt for stability detection
                 now = self.reactor.monotonic()
@@ -528,6 +686,53 @@ class AceSerialManager:
             self.reactor.monotonic() + initial_delay
         )
 
+    def _start_hotplug_watcher(self):
+        """Start this transport's /dev watcher once if hot-plug detection is enabled."""
+        if not self.hotplug_enabled or self.hotplug_watcher is not None:
+            return
+        watcher = AceHotplugWatcher(self.reactor, self._on_hotplug_event)
+        if watcher.start():
+            self.hotplug_watcher = watcher
+            logging.info(f'ACE[{self.instance_num}]: Hot-plug detection active')
+        else:
+            logging.info(
+                f'ACE[{self.instance_num}]: Hot-plug detection unavailable, using retry backoff only'
+            )
+
+    def stop_hotplug_watcher(self):
+        """Stop watching for device nodes and close the inotify descriptor."""
+        if self.hotplug_watcher is not None:
+            self.hotplug_watcher.stop()
+            self.hotplug_watcher = None
+
+    def _hotplug_port_matches(self, path):
+        """True if a new device node may be this instance's ACE."""
+        if not self._usb_location:
+            return True
+        location = self._get_usb_location_for_port(os.path.realpath(path))
+        return location is None or location == self._usb_location
+
+    def _on_hotplug_event(self, path):
+        """Pull a pending reconnect forward when a matching serial device appears."""
+        self.port_inventory.invalidate("hotplug")
+        if not self._ace_pro_enabled or self.is_connected() or self.connect_timer is None:
+            return
+        if not self._hotplug_port_matches(path):
+            return
+        logging.info(f'ACE[{self.instance_num}]: Serial device {path} appeared, reconnecting now')
+        self._hotplug_retries = self.HOTPLUG_MAX_RETRIES
+        self._reconnect_trigger = "hotplug"
+        self.reactor.update_timer(
+            self.connect_timer, self.reactor.monotonic() + self.HOTPLUG_SETTLE_S
+        )
+
+    def _consume_hotplug_retry(self):
+        """After a failed attempt, True if a device event still grants a quick retry."""
+        if self._hotplug_retries <= 0:
+            return False
+        self._hotplug_retries -= 1
+        return True
+
     def ensure_connect_timer(self):
         """Ensure a reconnect timer is scheduled if disconnected."""
         if self._ace_pro_enabled and not self.is_connected() and self.connect_timer is None:
@@ -547,7 +752,9 @@ class AceSerialManager:
         port = self.find_connection_port(instance)
         if port is None:
             self.gcode.respond_info(f'ACE[{instance}]: No ACE device found')
+            self.port_inventory.invalidate("no device found")
             return False
+        self._mark_startup("probe")
 
         self._port = port
         self._baud = baud
@@ -562,8 +769,10 @@ class AceSerialManager:
             self.gcode.respond_info(
                 f'ACE[{instance}]: auto_connect: Failed to connect to {port}, retrying in 1s'
             )
+            self.port_inventory.invalidate("connect failed")
             return False
 
+        self._mark_startup("open")
         logging.info(
             f'ACE[{instance}]: auto_connect: Connected to {port}, sending get_info request'
         )
@@ -574,6 +783,7 @@ class AceSerialManager:
                 f'ACE[{instance}]: Topology validation failed - disconnecting and retrying'
             )
             self.disconnect()
+            self.port_inventory.invalidate("topology mismatch")
             return False
 
         # Shared-bus transports defer info queries to the bus session
@@ -589,6 +799,8 @@ class AceSerialManager:
         """
         Log get_info response with port and USB topology context.
         """
+        if response is not None:
+            self._mark_startup("info")
         port = getattr(self, "serial_name", None) or self._port or "unknown"
         topo = self._usb_location or "unknown"
         raw_info = json.dumps(response, sort_keys=True, default=str)
@@ -671,11 +883,19 @@ class AceSerialManager:
                 # Flush buffers to discard any stale data from previous session
                 self._serial.reset_input_buffer()
                 self._serial.reset_output_buffer()
+                self.tx_pacer.reset()
+                self._record_reconnect_duration()
+                if self.wire_recorder is not None:
+                    self.wire_recorder.record_event(f"connect {port} {baud}")
 
                 if self.writer_timer is None:
                     self.writer_timer = self.reactor.register_timer(self._writer, self.reactor.NOW)
-                if self.reader_timer is None:
-                    self.reader_timer = self.reactor.register_timer(self._reader, self.reactor.NOW)
+                if self.deadline_timer is None:
+                    self._next_deadline = self.reactor.NOW
+                    self.deadline_timer = self.reactor.register_timer(
+                        self._deadline_check, self.reactor.NOW
+                    )
+                self._start_reader()
 
                 if self.connect_timer is not None:
                     self.reactor.unregister_timer(self.connect_timer)
@@ -714,9 +934,25 @@ class AceSerialManager:
             self._serial = None
         return False
 
+    def shutdown(self):
+        """
+        Disconnect for good (klippy:disconnect, e.g. FIRMWARE_RESTART).
+
+        Unlike disconnect(), which reconnect() also uses, this releases the
+        hot-plug watcher so its inotify descriptor is not leaked when klippy
+        builds a fresh manager, and closes the wire log.
+        """
+        self.disconnect()
+        self.stop_hotplug_watcher()
+        if self.wire_recorder is not None:
+            self.wire_recorder.close()
+
     def disconnect(self):
         """Close serial connection and stop all timers."""
         self.stop_heartbeat()
+        # Drop the fd registration before the descriptor is closed and reused
+        self._stop_reader_fd()
+        self._stop_io_thread()
 
         if self._serial and self._serial.is_open:
             try:
@@ -724,8 +960,13 @@ class AceSerialManager:
             except Exception as e:
                 logging.error(f"ACE[{self.instance_num}]: Error closing serial: {e}")
 
+        if self._connected and self._disconnected_at is None:
+            self._disconnected_at = self.reactor.monotonic()
+        if self._connected and self.wire_recorder is not None:
+            self.wire_recorder.record_event("disconnect")
+            self.wire_recorder.flush()
         self._connected = False
-        self.read_buffer = bytearray()
+        self._reset_frame_parser()
         self.clear_queues()
 
         # Clear supervision counters on disconnect
@@ -740,7 +981,16 @@ class AceSerialManager:
                 pass
             self.writer_timer = None
 
-        # Stop reader timer
+        # Stop timeout / supervision deadline timer
+        if self.deadline_timer:
+            try:
+                self.reactor.unregister_timer(self.deadline_timer)
+            except Exception:
+                pass
+            self.deadline_timer = None
+            self._next_deadline = None
+
+        # Stop reader timer / fd registration
         if self.reader_timer:
             try:
                 self.reactor.unregister_timer(self.reader_timer)
@@ -759,6 +1009,14 @@ class AceSerialManager:
             f"ACE[{self.instance_num}]: Disconnected - all timers stopped"
         )
 
+    def _record_reconnect_duration(self):
+        """Remember how long the link was down and what brought it back."""
+        if self._disconnected_at is not None:
+            self._last_reconnect_duration = self.reactor.monotonic() - self._disconnected_at
+            self._last_reconnect_trigger = self._reconnect_trigger
+            self._disconnected_at = None
+        self._reconnect_trigger = "backoff"
+
     def is_connected(self):
         """Check if serial connection is active."""
         return self._connected and self._serial and self._serial.is_open
@@ -855,7 +1113,7 @@ class AceSerialManager:
     def _supervision_check_and_recover(self):
         """
         Periodically check communication health and force reconnection if unhealthy.
-        Called from writer timer.
+        Called from the deadline timer.
         """
         # Skip if supervision is disabled
         if not self._supervision_enabled:
@@ -936,129 +1194,233 @@ class AceSerialManager:
                 "window_seconds": self.COMM_SUPERVISION_WINDOW,
                 "check_interval": self.SUPERVISION_CHECK_INTERVAL,
                 "time_since_check": time_since_check,
-            }
+            },
+            "reader": {
+                "mode": "thread" if self._io_thread is not None else (
+                    "fd" if self.reader_fd_handle is not None else (
+                        "timer" if self.reader_timer is not None else self.reader_mode
+                    )
+                ),
+                "wakeups": self._reader_wakeups,
+                "empty_wakeups": self._reader_empty_wakeups,
+            },
+            "timeouts": {
+                "adaptive": self.rtt_estimator.enabled,
+                "default_s": self.timeout_s,
+                "commands": self.rtt_estimator.snapshot(),
+            },
+            "frame_cache": self.protocol.get_frame_cache_stats(),
+            "coalesced_requests": self._coalesced_requests,
+            "queue": self._queue_status(),
+            "pacing": self.tx_pacer.snapshot(),
+            "metrics": self.metrics.snapshot(),
+            "wire_log": self.wire_recorder.snapshot() if self.wire_recorder is not None else None,
+            "heartbeat": self.heartbeat_policy.snapshot(self.reactor.monotonic()),
+            "port_inventory": self.port_inventory.snapshot(),
+            "hotplug": {
+                "enabled": self.hotplug_watcher is not None and self.hotplug_watcher.active,
+                "events": self.hotplug_watcher.events if self.hotplug_watcher is not None else 0,
+                "last_reconnect_s": self._last_reconnect_duration,
+                "last_reconnect_trigger": self._last_reconnect_trigger,
+            },
         }
 
+    def _queue_status(self):
+        """Scheduler snapshot with the in-flight count of each flow added."""
+        status = self._scheduler.snapshot()
+        flows = status["flows"]
+        for flow in flows.values():
+            flow["inflight"] = 0
+        with self._lock:
+            for flow in self._inflight_flows.values():
+                flows.setdefault(flow, {"queued": 0, "dispatched": 0, "inflight": 0})
+                flows[flow]["inflight"] += 1
+        return status
+
     # ========== CRC Calculation ==========
 
     def _calc_crc(self, buffer):
-        """Calculate CRC-16 for payload."""
-        _crc = 0xffff
-        for byte in buffer:
-            data = byte
-            data ^= _crc & 0xff
-            data ^= (data & 0x0f) << 4
-            _crc = ((data << 8) | (_crc >> 8)) ^ (data >> 4) ^ (data << 3)
-        return _crc
+        """Calculate CRC-16/MCRF4XX for payload (see crc.py)."""
+        return crc16_mcrf4xx(buffer)
 
     # ========== Request/Response Queuing ==========
 
-    def send_request(self, request, callback):
+    def send_request(self, request, callback, max_wait=None):
         """
         Queue a normal-priority request.
 
         Args:
             request: Dict with JSON-serializable request
             callback: Callable(response=dict) or Callable(response=None) on timeout
+            max_wait: Drop the request (callback gets None) if it is still
+                queued after this many seconds
         """
         if not self._ace_pro_enabled:
             self.gcode.respond_info(
                 f"ACE[{self.instance_num}]: Dropping request — ACE Pro is disabled"
             )
             return
-        try:
-            normalized_request = self.protocol.normalize_request(request)
-            self._queue.put([normalized_request, callback], timeout=1)
-        except queue.Full:
+        if not self._enqueue(request, callback, AceRequestScheduler.NORMAL, max_wait):
             self.gcode.respond_info(f"ACE[{self.instance_num}]: Request queue full!")
+            return
+        self._wake_writer()
 
-    def send_high_prio_request(self, request, callback):
+    def send_high_prio_request(self, request, callback, max_wait=None):
         """
         Queue a high-priority request (processed before normal queue).
 
         Args:
             request: Dict with JSON-serializable request
             callback: Callable as in send_request
+            max_wait: As in send_request
         """
         if not self._ace_pro_enabled:
             self.gcode.respond_info(
                 f"ACE[{self.instance_num}]: Dropping high-priority request — ACE Pro is disabled"
             )
             return
-        try:
-            normalized_request = self.protocol.normalize_request(request)
-            self._hp_queue.put([normalized_request, callback], timeout=1)
-        except queue.Full:
+        if not self._enqueue(request, callback, AceRequestScheduler.HIGH, max_wait):
             self.gcode.respond_info(
                 f"ACE[{self.instance_num}]: High-priority queue full!"
             )
+            return
+        self._wake_writer()
+
+    def _enqueue(self, request, callback, priority, max_wait):
+        """Normalize, coalesce and schedule a request; False if the queue is full."""
+        normalized_request = self.protocol.normalize_request(request)
+        high_prio = priority == AceRequestScheduler.HIGH
+        queued_callback = self._coalesce_request(
+            normalized_request, callback, high_prio=high_prio, supersede=max_wait is not None
+        )
+        if queued_callback is None:
+            return True
+        flow = self.protocol.get_request_flow_key(normalized_request)
+        if self._scheduler.push(normalized_request, queued_callback, priority, max_wait, flow):
+            return True
+        if isinstance(queued_callback, CoalescedRequest) and queued_callback.callbacks == [callback]:
+            # Nothing else waits on this group; do not leave it registered
+            self._release_coalesced(queued_callback)
+        return False
+
+    def _coalesce_request(self, request, callback, high_prio, supersede=False):
+        """
+        Merge an idempotent read into an identical queued or in-flight one.
+
+        With ``supersede`` a still-queued identical read is replaced instead:
+        its waiters move to the new request and the old queue entry is left
+        empty, so it is dropped rather than sent.
+
+        A callback already waiting on the group (compared with ``==``, so a
+        re-bound method matches) is not added again: a repeated heartbeat
+        gets one call per reply, not one per poll it was merged with.
+
+        Returns:
+            The callback to enqueue with the request, or None when the caller
+            was attached to an existing request and nothing must be queued.
+        """
+        key = self.protocol.get_coalesce_key(request)
+        if key is None:
+            return callback
+
+        with self._lock:
+            group = self._coalesced.get(key)
+            if group is None or (supersede and not group.sent):
+                new_group = CoalescedRequest(self, key, high_prio)
+                if group is not None:
+                    new_group.callbacks.extend(group.callbacks)
+                    group.callbacks = []
+                    group.sent = True
+                    self._coalesced_requests += 1
+                if callback not in new_group.callbacks:
+                    new_group.callbacks.append(callback)
+                self._coalesced[key] = new_group
+                return new_group
+
+            if callback not in group.callbacks:
+                group.callbacks.append(callback)
+            self._coalesced_requests += 1
+            if high_prio and not group.high_prio and not group.sent:
+                # Still waiting in the normal queue: queue a high-priority
+                # copy; whichever is dequeued first is sent, the other dropped.
+                group.high_prio = True
+                return group
+            return None
+
+    def _release_coalesced(self, group):
+        """Forget a coalesced group once its response or timeout arrives."""
+        with self._lock:
+            if self._coalesced.get(group.key) is group:
+                del self._coalesced[group.key]
 
     def clear_queues(self):
         """Clear all pending requests."""
-        self._clear_queue(self._queue)
-        self._clear_queue(self._hp_queue)
+        self._scheduler.clear()
+        self._paced_frame = None
         with self._lock:
+            self._coalesced.clear()
             self._callback_map.clear()
             self.inflight.clear()
-
-    def _clear_queue(self, q):
-        """Remove all items from queue."""
-        if q is None:
-            return
-        try:
-            while True:
-                q.get_nowait()
-        except queue.Empty:
-            pass
+            self._inflight_timeouts.clear()
+            self._inflight_commands.clear()
+            self._inflight_flows.clear()
+            self._inflight_shortened.clear()
+            self._expired_early.clear()
+            self.metrics.set_window(0)
 
     # ========== Low-Level Frame Sending ==========
 
-    def _send_frame(self, request):
-        """Send a serialized request frame."""
+    def _send_frame(self, request, data=None):
+        """Send a request frame, serializing it unless ``data`` is given."""
         if not self.is_connected():
             self.gcode.respond_info(f"ACE[{self.instance_num}]: Serial not connected, skipping send")
             return
 
-        with self._lock:
-            if 'id' not in request:
-                request['id'] = self._request_id
-                self._request_id += 1
+        if data is None:
+            with self._lock:
+                if 'id' not in request:
+                    request['id'] = self._request_id
+                    self._request_id += 1
 
-        data = self.protocol.serialize_request_frame(request, self._calc_crc)
+            data = self.protocol.serialize_request_frame(request, self._calc_crc)
+
+        if self._io_thread is not None:
+            # Written by the I/O thread, which also counts and records it once
+            # the write succeeds; failures come back as write_error events
+            self._io_thread.send(request.get('id'), data)
+            return
 
         try:
             with self._serial_lock:
                 self._serial.write(data)
+            self.metrics.record_tx(len(data))
+            if self.wire_recorder is not None:
+                self.wire_recorder.record_tx(data)
         except serial.SerialTimeoutException as e:
+            self._handle_write_error(request.get('id'), e, timed_out=True)
+        except Exception as e:
+            self._handle_write_error(request.get('id'), e)
+
+    def _handle_write_error(self, rid, error, timed_out=False):
+        """Report a failed frame write and fail its in-flight request."""
+        if timed_out:
             self.gcode.respond_info(
-                f"ACE[{self.instance_num}]: Serial write timeout: {e} (clearing inflight)"
+                f"ACE[{self.instance_num}]: Serial write timeout: {error} (clearing inflight)"
             )
-            with self._lock:
-                rid = request.get('id')
-                if rid in self.inflight:
-                    self.inflight.pop(rid, None)
-                    cb = self._callback_map.pop(rid, None)
-                    if cb:
-                        try:
-                            cb(response=None)
-                        except Exception as cb_e:
-                            self.gcode.respond_info(
-                                f"ACE[{self.instance_num}]: Timeout callback error: {cb_e}"
-                            )
-        except Exception as e:
-            self.gcode.respond_info(f"ACE[{self.instance_num}]: Serial write error: {e}")
-            with self._lock:
-                rid = request.get('id')
-                if rid in self.inflight:
-                    self.inflight.pop(rid, None)
-                    cb = self._callback_map.pop(rid, None)
-                    if cb:
-                        try:
-                            cb(response=None)
-                        except Exception as cb_e:
-                            self.gcode.respond_info(
-                                f"ACE[{self.instance_num}]: Error callback error: {cb_e}"
-                            )
+        else:
+            self.gcode.respond_info(f"ACE[{self.instance_num}]: Serial write error: {error}")
+        with self._lock:
+            if rid in self.inflight:
+                self._forget_inflight(rid)
+                cb = self._callback_map.pop(rid, None)
+                if cb:
+                    try:
+                        cb(response=None)
+                    except Exception as cb_e:
+                        label = "Timeout" if timed_out else "Error"
+                        self.gcode.respond_info(
+                            f"ACE[{self.instance_num}]: {label} callback error: {cb_e}"
+                        )
 
     # ========== Frame Reading and Parsing ==========
 
@@ -1067,28 +1429,42 @@ class AceSerialManager:
     def has_pending_requests(self):
         """Check if any requests are queued or in-flight."""
         with self._lock:
-            return len(self.inflight) > 0 or not self._queue.empty() or not self._hp_queue.empty()
+            return (
+                len(self.inflight) > 0
+                or len(self._scheduler) > 0
+                or self._paced_frame is not None
+            )
 
     def get_pending_request(self):
         """
-        Get next request to send (respecting priority).
+        Get next request to send (priority class first, then age).
+
+        Requests that waited past their max_wait are dropped here and their
+        callbacks completed with None.
 
         Returns:
             tuple: (request_dict, callback) or (None, None) if no requests
         """
-        if not self._hp_queue.empty():
-            try:
-                return self._hp_queue.get_nowait()
-            except queue.Empty:
-                pass
-
-        if not self._queue.empty():
+        entry, stale = self._scheduler.pop(capped=self._capped_flows())
+        for _, callback in stale:
             try:
-                return self._queue.get_nowait()
-            except queue.Empty:
-                pass
+                callback(response=None)
+            except Exception as e:
+                self.gcode.respond_info(
+                    f"ACE[{self.instance_num}]: Stale request callback error: {e}"
+                )
+        return entry
 
-        return None, None
+    def _capped_flows(self):
+        """Bus devices already holding DEVICE_WINDOW_SIZE in-flight requests."""
+        with self._lock:
+            if len(self._inflight_flows) < self.DEVICE_WINDOW_SIZE:
+                return ()
+            counts = {}
+            for flow in self._inflight_flows.values():
+                if flow is not None:
+                    counts[flow] = counts.get(flow, 0) + 1
+        return {flow for flow, count in counts.items() if count >= self.DEVICE_WINDOW_SIZE}
 
     def dispatch_response(self, response):
         """
@@ -1103,12 +1479,22 @@ class AceSerialManager:
         rid = response.get('id')
         cb = None
 
+        t0 = None
+        command = None
         with self._lock:
             if rid is not None:
                 cb = self._callback_map.pop(rid, None)
                 if cb:
-                    self.inflight.pop(rid, None)
+                    t0, command = self._forget_inflight(rid)
 
+        if t0 is not None and command is not None:
+            rtt = self.reactor.monotonic() - t0
+            self.rtt_estimator.observe(command, rtt)
+            self.metrics.record_rtt(command, rtt)
+
+        if cb is not None:
+            # An in-flight slot just freed up; let queued work use it now
+            self._wake_writer()
         return cb, cb is not None
 
     def set_heartbeat_callback(self, callback):
@@ -1135,11 +1521,21 @@ class AceSerialManager:
         """Set callback for handling unsolicited responses."""
         self.unsolicited_response_callback = callback
 
+    @property
+    def heartbeat_interval(self):
+        """Normal status poll interval (the policy's "active" cadence)."""
+        return self.heartbeat_policy.base_interval
+
+    @heartbeat_interval.setter
+    def heartbeat_interval(self, value):
+        self.heartbeat_policy.base_interval = float(value)
+
     def start_heartbeat(self):
         """
         Start the heartbeat timer to send periodic status requests.
 
-        First request sent immediately, then repeated at heartbeat_interval.
+        First request sent immediately, then repeated at the interval chosen
+        by heartbeat_policy (heartbeat_interval unless adaptive).
         """
         if self.protocol.get_transport_spec().shared_bus:
             logging.info(
@@ -1162,6 +1558,7 @@ class AceSerialManager:
 
     def stop_heartbeat(self):
         """Stop the heartbeat timer."""
+        self._next_heartbeat = None
         if self.heartbeat_timer is not None:
             try:
                 self.reactor.unregister_timer(self.heartbeat_timer)
@@ -1180,148 +1577,578 @@ class AceSerialManager:
             now = self.reactor.monotonic()
             self._send_heartbeat_request()
             self._last_status_request_time = now
-
-            return eventtime + self.heartbeat_interval
         except Exception as e:
             logging.warning(
                 f"ACE[{self.instance_num}]: Heartbeat tick error: {e}"
             )
-            return eventtime + self.heartbeat_interval
+        self._next_heartbeat = eventtime + self.heartbeat_policy.interval(eventtime)
+        return self._next_heartbeat
+
+    def heartbeat_soon(self):
+        """
+        Pull the next status poll forward to the policy's fastest interval.
+
+        Called when a command is queued or an operation starts waiting on
+        the unit, so an idle 5 s cadence does not delay the first status.
+        """
+        if self.heartbeat_timer is None:
+            return
+        due = self.reactor.monotonic() + self.heartbeat_policy.soonest_interval()
+        if self._next_heartbeat is not None and self._next_heartbeat <= due:
+            return
+        self._next_heartbeat = due
+        try:
+            self.reactor.update_timer(self.heartbeat_timer, due)
+        except Exception as e:
+            logging.warning(f"ACE[{self.instance_num}]: Heartbeat reschedule failed: {e}")
+
+    def _heartbeat_response(self, response=None):
+        if self.heartbeat_callback:
+            try:
+                self.heartbeat_callback(response)
+            except Exception as e:
+                logging.warning(
+                    f"ACE[{self.instance_num}]: Heartbeat callback error: {e}"
+                )
 
     def _send_heartbeat_request(self):
         """Send a status request to the ACE device via the queue."""
         request = self.protocol.build_get_status_request()
+        # A poll still queued when the next one is due is superseded by it;
+        # the bound method is one callback however many polls are merged
+        max_wait = self.heartbeat_policy.current_interval(self.reactor.monotonic())
+        self.send_high_prio_request(request, self._heartbeat_response, max_wait=max_wait)
+
+    def _wake_writer(self):
+        """Run the writer on the next reactor pass instead of waiting for a tick."""
+        if self.writer_timer is None:
+            return
+        try:
+            self.reactor.update_timer(self.writer_timer, self.reactor.NOW)
+        except Exception as e:
+            logging.warning(f"ACE[{self.instance_num}]: Writer wake failed: {e}")
+
+    def _arm_deadline(self, deadline):
+        """Pull the deadline timer forward if a new request expires sooner."""
+        if self.deadline_timer is None:
+            return
+        if self._next_deadline is not None and self._next_deadline <= deadline:
+            return
+        self._next_deadline = deadline
+        try:
+            self.reactor.update_timer(self.deadline_timer, deadline)
+        except Exception as e:
+            logging.warning(f"ACE[{self.instance_num}]: Deadline timer update failed: {e}")
+
+    def _request_timeout(self, request):
+        """
+        Pick the timeout for one outgoing request.
+
+        Only coalescible reads may drop below ``timeout_s``; everything else
+        keeps the fixed timeout as a floor.
+
+        Returns:
+            tuple: (command class, timeout in seconds)
+        """
+        command = self.protocol.get_request_command_name(request)
+        if not self.rtt_estimator.enabled:
+            return command, self.timeout_s
+        hint = self.protocol.get_request_timeout_hint(request)
+        timeout = self.rtt_estimator.timeout_for(command, hint or self.timeout_s)
+        if self.protocol.get_coalesce_key(request) is None:
+            # Not an idempotent read: callers re-send on a timeout, so a late
+            # ack to an early expiry would repeat filament motion
+            timeout = max(timeout, self.timeout_s)
+        return command, timeout
+
+    def _forget_inflight(self, rid):
+        """
+        Drop all in-flight bookkeeping for one request (caller holds _lock).
+
+        Returns:
+            tuple: (send time, command class), either may be None
+        """
+        self._inflight_timeouts.pop(rid, None)
+        self._inflight_flows.pop(rid, None)
+        self._inflight_shortened.discard(rid)
+        t0 = self.inflight.pop(rid, None)
+        if t0 is not None:
+            self.metrics.set_window(len(self.inflight))
+        return t0, self._inflight_commands.pop(rid, None)
+
+    def _expire_inflight(self, now):
+        """
+        Fail in-flight requests whose timeout has elapsed.
 
-        def _heartbeat_response(response):
-            if self.heartbeat_callback:
+        Returns:
+            Monotonic time of the earliest remaining deadline, or None.
+        """
+        expired = []
+        next_deadline = None
+        with self._lock:
+            for rid, t0 in list(self.inflight.items()):
+                elapsed = now - t0
+                timeout = self._inflight_timeouts.get(rid, self.timeout_s)
+                if elapsed >= timeout:
+                    shortened = rid in self._inflight_shortened
+                    _, command = self._forget_inflight(rid)
+                    if shortened:
+                        self._remember_expired_early(rid, t0, command, now)
+                    expired.append(
+                        (rid, elapsed, command, shortened, self._callback_map.pop(rid, None))
+                    )
+                    continue
+                deadline = t0 + timeout
+                if next_deadline is None or deadline < next_deadline:
+                    next_deadline = deadline
+
+        for rid, elapsed, command, shortened, cb in expired:
+            self.gcode.respond_info(
+                f"ACE[{self.instance_num}]: Request ID={rid} TIMEOUT after {elapsed:.1f}s"
+                + (" (adaptive)" if shortened else "")
+            )
+            self.rtt_estimator.on_timeout(command)
+            self.metrics.record_timeout(command)
+            # Only a request that outlived its fixed timeout says the link is
+            # unhealthy; an adaptive cut-off just means the estimate was low
+            if not shortened:
+                self._track_comm_timeout()
+            if cb:
                 try:
-                    self.heartbeat_callback(response)
+                    cb(response=None)
                 except Exception as e:
-                    logging.warning(
-                        f"ACE[{self.instance_num}]: Heartbeat callback error: {e}"
+                    self.gcode.respond_info(
+                        f"ACE[{self.instance_num}]: Callback error: {e}"
                     )
 
-        self.send_high_prio_request(request, _heartbeat_response)
+        if expired:
+            self._wake_writer()
+        return next_deadline
+
+    def _remember_expired_early(self, rid, t0, command, now):
+        """Keep a request cut off by its adaptive timeout so a late reply is recognised."""
+        cutoff = now - self.LATE_REPLY_WINDOW_S
+        for old_rid in [r for r, (sent, _) in self._expired_early.items() if sent < cutoff]:
+            del self._expired_early[old_rid]
+        self._expired_early[rid] = (t0, command)
+
+    def _handle_late_reply(self, ret):
+        """
+        Absorb a reply to a request already failed by its adaptive timeout.
+
+        Returns:
+            bool: True if ``ret`` was such a reply
+        """
+        entry = self._expired_early.pop(ret.get('id'), None)
+        if entry is None:
+            return False
+        t0, command = entry
+        rtt = self.reactor.monotonic() - t0
+        # The real round trip corrects the estimate that cut it off
+        self.rtt_estimator.observe(command, rtt)
+        logging.info(
+            f"ACE[{self.instance_num}]: Late reply ID={ret.get('id')} ({command}) after {rtt:.2f}s"
+        )
+        return True
+
+    def _deadline_check(self, eventtime):
+        """Timer callback: expire timed-out requests and run health supervision."""
+        now = self.reactor.monotonic()
+        try:
+            self._expire_inflight(now)
+        except Exception as e:
+            logging.info(f'ACE[{self.instance_num}]: Timeout scan error {str(e)}')
+
+        # Check communication health and force reconnection if needed
+        try:
+            self._supervision_check_and_recover()
+        except Exception as e:
+            logging.warning(f"ACE[{self.instance_num}]: Supervision check error: {e}")
+
+        if self.deadline_timer is None:
+            # Supervision forced a disconnect; timer already unregistered
+            return self.reactor.NEVER
+
+        # Recompute after callbacks: they may have queued and sent new requests
+        with self._lock:
+            deadlines = [
+                t0 + self._inflight_timeouts.get(rid, self.timeout_s)
+                for rid, t0 in self.inflight.items()
+            ]
+        next_wake = self.reactor.NEVER
+        if deadlines:
+            next_wake = eventtime + max(0.0, min(deadlines) - now)
+        if self._supervision_enabled:
+            next_wake = min(next_wake, eventtime + self.SUPERVISION_CHECK_INTERVAL)
+        self._next_deadline = next_wake
+        return next_wake
 
     def _writer(self, eventtime):
-        """Timer callback: send requests from queue, handle timeouts, fill window."""
+        """
+        Timer callback: fill the in-flight window from the queues.
+
+        Frames are paced by tx_pacer; a frame that does not fit the byte
+        budget is held and the writer sleeps until it does. Otherwise it
+        sleeps until woken by an enqueue, a dispatched response or an
+        expired request; timeouts are handled by _deadline_check.
+        """
         try:
             now = self.reactor.monotonic()
 
-            with self._lock:
-                for rid, t0 in list(self.inflight.items()):
-                    elapsed = now - t0
-                    if elapsed > self.timeout_s:
-                        self.gcode.respond_info(
-                            f"ACE[{self.instance_num}]: Request ID={rid} TIMEOUT after {elapsed:.1f}s"
-                        )
-                        # Track timeout for communication health supervision
-                        self._track_comm_timeout()
-                        cb = self._callback_map.pop(rid, None)
-                        if cb:
-                            try:
-                                cb(response=None)
-                            except Exception as e:
-                                self.gcode.respond_info(
-                                    f"ACE[{self.instance_num}]: Callback error: {e}"
-                                )
-                        self.inflight.pop(rid, None)
-
             # Fill window with new requests
             while True:
                 with self._lock:
                     if len(self.inflight) >= self.WINDOW_SIZE:
                         break
 
-                req, cb = self.get_pending_request()
-                if req is None:
-                    # No pending requests - writer loop idle
-                    # Heartbeat timer handles periodic status updates
-                    break
-
+                if self._paced_frame is not None:
+                    req, cb, data, held_since = self._paced_frame
+                else:
+                    req, cb = self.get_pending_request()
+                    if req is None:
+                        # No pending requests - writer loop idle
+                        # Heartbeat timer handles periodic status updates
+                        break
+                    if isinstance(cb, CoalescedRequest) and not cb.claim():
+                        # Duplicate queue entry of a coalesced read already sent
+                        continue
+                    data = self._serialize_request(req, cb)
+                    if data is None:
+                        continue
+                    held_since = None
+
+                delay = self.tx_pacer.reserve(len(data), now)
+                if delay > 0.0:
+                    if held_since is None:
+                        self._paced_frame = (req, cb, data, now)
+                    return eventtime + delay
+                self._paced_frame = None
+                if held_since is not None:
+                    self.tx_pacer.record_paced(now - held_since)
+
+                command, timeout = self._request_timeout(req)
                 with self._lock:
-                    rid = self._request_id
-                    self._request_id += 1
-                    req['id'] = rid
+                    rid = req['id']
                     self._callback_map[rid] = cb
                     self.inflight[rid] = now
-
-                self._send_frame(req)
+                    self._inflight_timeouts[rid] = timeout
+                    self._inflight_commands[rid] = command
+                    if timeout < self.timeout_s:
+                        self._inflight_shortened.add(rid)
+                    self._inflight_flows[rid] = self.protocol.get_request_flow_key(req)
+                    self.metrics.set_window(len(self.inflight))
+
+                self._arm_deadline(eventtime + timeout)
+                self._send_frame(req, data)
         except Exception as e:
             logging.info(f'ACE[{self.instance_num}]: Write error {str(e)}')
             self.gcode.respond_info(str(e))
+            # Queued work may remain; retry shortly rather than waiting for a wake
+            return eventtime + 0.1
 
-        # Check communication health and force reconnection if needed
-        try:
-            self._supervision_check_and_recover()
-        except Exception as e:
-            logging.warning(f"ACE[{self.instance_num}]: Supervision check error: {e}")
+        return self.reactor.NEVER
 
-        return eventtime + 0.1
+    def _serialize_request(self, request, callback):
+        """
+        Assign the next request ID and encode the wire frame.
 
-    def _reader(self, eventtime):
-        """Timer callback: read frames from serial, dispatch responses."""
+        A request that cannot be encoded is failed immediately with
+        callback(response=None) and None is returned.
+        """
+        with self._lock:
+            request['id'] = self._request_id
+            self._request_id += 1
         try:
-            raw = self._serial.read(size=4096)
-        except SerialException:
+            return self.protocol.serialize_request_frame(request, self._calc_crc)
+        except Exception as e:
             self.gcode.respond_info(
-                f"ACE[{self.instance_num}]: Unable to communicate with ACE\n" +
-                traceback.format_exc()
+                f"ACE[{self.instance_num}]: Cannot encode request ID={request['id']}: {e}"
             )
-
-            if not self._ace_pro_enabled:
+            try:
+                callback(response=None)
+            except Exception as cb_e:
                 self.gcode.respond_info(
-                    f"ACE[{self.instance_num}]: ACE Pro disabled - not scheduling reconnect"
+                    f"ACE[{self.instance_num}]: Callback error: {cb_e}"
                 )
-                return self.reactor.NEVER  # Stop this timer too
+            return None
 
-            # Try to reconnect
-            if self.connect_timer is None:
-                self.gcode.respond_info(f"ACE[{self.instance_num}]: Scheduling reconnect")
-                self.reconnect()
-                return self.reactor.NOW + 1.5
-            else:
-                self.gcode.respond_info(
-                    f"ACE[{self.instance_num}]: Scheduling reconnect (already scheduled)"
+    def _start_reader(self):
+        """Start reading from the open port using the configured reader mode."""
+        if self.reader_mode == "thread" and self._io_thread is None:
+            try:
+                self._start_io_thread()
+                return
+            except Exception as e:
+                logging.warning(
+                    f"ACE[{self.instance_num}]: I/O thread unavailable ({e}), using fd reader"
                 )
+                self._io_thread = None
+        if self.reader_mode in ("fd", "thread") and self.reader_fd_handle is None:
+            try:
+                fd = self._serial.fileno()
+                self.reader_fd_handle = self.reactor.register_fd(fd, self._fd_reader)
+                logging.info(
+                    f"ACE[{self.instance_num}]: Reader registered on fd {fd}"
+                )
+                return
+            except Exception as e:
+                logging.warning(
+                    f"ACE[{self.instance_num}]: fd reader unavailable ({e}), "
+                    f"falling back to {self.READER_POLL_INTERVAL * 1000:.0f} ms polling"
+                )
+                self.reader_fd_handle = None
+        if self.reader_fd_handle is None and self.reader_timer is None:
+            self.reader_timer = self.reactor.register_timer(self._reader, self.reactor.NOW)
+
+    def _start_io_thread(self):
+        """Hand port reads, writes and frame parsing to a dedicated thread."""
+        io_thread = AceSerialIoThread(
+            self._serial,
+            AceFrameParser(self.protocol, self._calc_crc, metrics=self.metrics),
+            wake=lambda: self.reactor.register_async_callback(self._drain_io_events),
+            name=f"ace{self.instance_num}-serial-io",
+        )
+        io_thread.recorder = self.wire_recorder
+        io_thread.metrics = self.metrics
+        io_thread.start()
+        self._io_thread = io_thread
+        self._io_bytes_seen = 0
+        logging.info(f"ACE[{self.instance_num}]: Serial I/O thread started")
+
+    def _stop_io_thread(self):
+        """
+        Stop the I/O thread, if running; queued events are discarded.
+
+        Does not wait: the thread closes the port itself once any write in
+        progress returns, so the handle is dropped here rather than closed
+        under it. The exited thread is reaped from a reactor timer.
+        """
+        io_thread = self._io_thread
+        if io_thread is None:
+            return
+        self._io_thread = None
+        io_thread.stop()
+        if self._serial is io_thread.port:
+            self._serial = None
+        now = self.reactor.monotonic()
+        self._retired_io_threads.append([io_thread, now, False])
+        if self._io_reaper_timer is None:
+            self._io_reaper_timer = self.reactor.register_timer(self._reap_io_threads)
+        self.reactor.update_timer(self._io_reaper_timer, now + self.IO_THREAD_REAP_INTERVAL)
+
+    def _reap_io_threads(self, eventtime):
+        """Timer callback: join stopped I/O threads that have exited."""
+        pending = []
+        for entry in self._retired_io_threads:
+            io_thread, stopped_at, warned = entry
+            if io_thread.join():
+                continue
+            if not warned:
+                entry[2] = True
+                logging.warning(
+                    f"ACE[{self.instance_num}]: {io_thread.name} still running "
+                    f"{eventtime - stopped_at:.1f}s after stop (write stalled?)"
+                )
+            pending.append(entry)
+        self._retired_io_threads = pending
+        if not pending:
             return self.reactor.NEVER
+        return eventtime + self.IO_THREAD_REAP_INTERVAL
 
-        if raw:
-            self.read_buffer += raw
-        else:
-            return eventtime + 0.05
+    def _drain_io_events(self, eventtime=None):
+        """Reactor async callback: process everything the I/O thread queued."""
+        io_thread = self._io_thread
+        if io_thread is None:
+            return
+        io_thread.acknowledge_wake()
+        self._reader_wakeups += 1
+        bytes_read = io_thread.bytes_read
+        self.metrics.record_rx(bytes_read - self._io_bytes_seen)
+        self._io_bytes_seen = bytes_read
+        if self._input_dispatch_active:
+            # A callback further up the stack paused the reactor; the outer
+            # drain loop picks up these events once it resumes.
+            return
 
-        responses, remaining_buffer, notices = self.protocol.extract_responses(
-            self.read_buffer,
-            self._calc_crc,
+        self._input_dispatch_active = True
+        try:
+            rx = io_thread.rx
+            while rx and self._io_thread is io_thread:
+                event = rx.popleft()
+                kind = event[0]
+                if kind == "response":
+                    self.metrics.record_rx(0, 1)
+                    self._dispatch_incoming(event[1])
+                elif kind == "notice":
+                    self.metrics.record_notice(event[1])
+                    self.gcode.respond_info(f"ACE[{self.instance_num}]: {event[1]}")
+                elif kind == "write_error":
+                    timeout_cls = getattr(serial, "SerialTimeoutException", None)
+                    timed_out = isinstance(timeout_cls, type) and isinstance(event[1], timeout_cls)
+                    self._handle_write_error(event[2], event[1], timed_out=timed_out)
+                elif kind == "read_error":
+                    self._stop_io_thread()
+                    self._handle_read_failure(detail=str(event[1]))
+                    break
+        finally:
+            self._input_dispatch_active = False
+
+    def _stop_reader_fd(self):
+        """Unregister the port fd from the reactor, if registered."""
+        if self.reader_fd_handle is None:
+            return
+        try:
+            self.reactor.unregister_fd(self.reader_fd_handle)
+        except Exception:
+            pass
+        self.reader_fd_handle = None
+
+    def _handle_read_failure(self, detail=None):
+        """
+        Report a failed serial read and schedule reconnection.
+
+        Args:
+            detail: Error text when not called from an exception handler
+
+        Returns:
+            Next wake time for the polling reader timer.
+        """
+        self.gcode.respond_info(
+            f"ACE[{self.instance_num}]: Unable to communicate with ACE\n" +
+            (detail if detail is not None else traceback.format_exc())
         )
-        self.read_buffer = remaining_buffer
 
-        for notice in notices:
-            self.gcode.respond_info(f"ACE[{self.instance_num}]: {notice}")
+        if not self._ace_pro_enabled:
+            self.gcode.respond_info(
+                f"ACE[{self.instance_num}]: ACE Pro disabled - not scheduling reconnect"
+            )
+            return self.reactor.NEVER  # Stop this timer too
+
+        # Try to reconnect
+        if self.connect_timer is None:
+            self.gcode.respond_info(f"ACE[{self.instance_num}]: Scheduling reconnect")
+            self.reconnect()
+            return self.reactor.NOW + 1.5
+        else:
+            self.gcode.respond_info(
+                f"ACE[{self.instance_num}]: Scheduling reconnect (already scheduled)"
+            )
+        return self.reactor.NEVER
 
-        for ret in responses:
-            if self._status_debug_logging:
-                self._status_update_callback(ret)
+    def _reader(self, eventtime):
+        """Timer callback: read frames from serial, dispatch responses."""
+        self._reader_wakeups += 1
+        try:
+            raw = self._serial.read(size=4096)
+        except SerialException:
+            return self._handle_read_failure()
 
-            cb, _ = self.dispatch_response(ret)
-            if cb:
-                try:
-                    cb(response=ret)
-                except Exception as e:
-                    self.gcode.respond_info(f"ACE[{self.instance_num}]: Callback error: {e}")
-            else:
-                # Try unsolicited callback first
-                if self.unsolicited_response_callback and self.unsolicited_response_callback(ret):
-                    continue
-                # Log unsolicited messages (no matching callback found)
-                response_id = ret.get('id', 'no-id')
-                response_str = json.dumps(ret)
-                self.gcode.respond_info(f"ACE[{self.instance_num}]: UNSOLICITED (ID={response_id}, current_id={self._request_id}): {response_str}")
-                # Track unsolicited message for communication health supervision
-                self._track_comm_unsolicited()
+        if not raw:
+            self._reader_empty_wakeups += 1
+            return eventtime + self.READER_POLL_INTERVAL
 
-        return eventtime + 0.05
+        self._process_serial_input(raw)
+        return eventtime + self.READER_POLL_INTERVAL
+
+    def _fd_reader(self, eventtime):
+        """Reactor fd callback: parse and dispatch frames as soon as bytes arrive."""
+        self._reader_wakeups += 1
+        try:
+            raw = self._serial.read(size=4096)
+        except SerialException:
+            # A readable fd that fails to read means the device went away;
+            # stop watching it so the reactor does not spin on a dead fd.
+            self._stop_reader_fd()
+            self._handle_read_failure()
+            return
+
+        if not raw:
+            self._reader_empty_wakeups += 1
+            return
+
+        self._process_serial_input(raw)
+
+    @property
+    def read_buffer(self):
+        """Unparsed serial bytes (copy); assigning replaces the parser input."""
+        if self._frame_parser is None:
+            return bytearray()
+        return self._frame_parser.pending()
+
+    @read_buffer.setter
+    def read_buffer(self, data):
+        self._get_frame_parser().reset(data)
+
+    def _get_frame_parser(self):
+        """Return the incremental parser for the active protocol adapter."""
+        parser = self._frame_parser
+        if parser is None or parser.adapter is not self.protocol:
+            pending = parser.pending() if parser is not None else b""
+            parser = AceFrameParser(self.protocol, self._calc_crc, metrics=self.metrics)
+            parser.append(pending)
+            self._frame_parser = parser
+        return parser
+
+    def _reset_frame_parser(self):
+        """Drop partially received frames (e.g. on disconnect)."""
+        if self._frame_parser is not None:
+            self._frame_parser.reset()
+
+    def _process_serial_input(self, raw):
+        """Append raw bytes to the frame parser and dispatch every complete frame."""
+        if self.wire_recorder is not None:
+            self.wire_recorder.record_rx(raw)
+        parser = self._get_frame_parser()
+        parser.append(raw)
+        self.metrics.record_rx(len(raw))
+        if self._input_dispatch_active:
+            # A response callback further up the stack paused the reactor and
+            # the fd fired again; the outer call parses these bytes once the
+            # current dispatch returns.
+            return
+
+        self._input_dispatch_active = True
+        try:
+            while len(parser):
+                responses, notices = parser.parse()
+
+                for notice in notices:
+                    self.metrics.record_notice(notice)
+                    self.gcode.respond_info(f"ACE[{self.instance_num}]: {notice}")
+
+                if not responses:
+                    break
+                self.metrics.record_rx(0, len(responses))
+                for ret in responses:
+                    self._dispatch_incoming(ret)
+        finally:
+            self._input_dispatch_active = False
+
+    def _dispatch_incoming(self, ret):
+        """Route one parsed response to its callback or the unsolicited handler."""
+        if self._status_debug_logging:
+            self._status_update_callback(ret)
+
+        cb, _ = self.dispatch_response(ret)
+        if cb:
+            try:
+                cb(response=ret)
+            except Exception as e:
+                self.gcode.respond_info(f"ACE[{self.instance_num}]: Callback error: {e}")
+            return
+
+        if self._handle_late_reply(ret):
+            return
+
+        # Try unsolicited callback first
+        if self.unsolicited_response_callback and self.unsolicited_response_callback(ret):
+            return
+        # Log unsolicited messages (no matching callback found)
+        response_id = ret.get('id', 'no-id')
+        response_str = json.dumps(ret)
+        self.gcode.respond_info(f"ACE[{self.instance_num}]: UNSOLICITED (ID={response_id}, current_id={self._request_id}): {response_str}")
+        # Track unsolicited message for communication health supervision
+        self._track_comm_unsolicited()
 
     def _status_update_callback(self, response):
         """
@@ -1354,6 +2181,11 @@ class AceSerialManager:
         if current_status is None:
             return
 
+        # Idle heartbeats repeat the previous result; nothing to log then
+        changed, dirty_slots = self._debug_status_delta.update(result)
+        if not changed:
+            return
+
         if raw_fields is not None:
             self.gcode.respond_info(
                 f"ACE[{self.instance_num}]: GET_STATUS raw_fields: {raw_fields}"
@@ -1390,6 +2222,8 @@ class AceSerialManager:
         # Detect slot status changes
         for slot in slots:
             slot_idx = slot.get("index")
+            if dirty_slots is not None and slot_idx not in dirty_slots:
+                continue
             slot_status = slot.get("status", "unknown")
 
             if slot_idx is not None:
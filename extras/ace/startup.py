@@ -0,0 +1,97 @@
+"""Per-unit startup phase timings measured from klippy:ready."""
+
+from __future__ import annotations
+
+from typing import Callable, Dict, Iterable, List, Optional
+
+
+class AceStartupTimeline:
+    """
+    Record when each ACE unit reaches each startup phase.
+
+    The manager calls start() on klippy:ready; serial managers and instances
+    then mark() phases as they happen. Only the first mark of a phase per
+    unit counts, so reconnects later in the session do not overwrite the
+    boot timings. Phases, in pipeline order:
+
+    - probe:  serial device enumerated
+    - open:   serial port opened
+    - info:   get_info answered
+    - status: first status (heartbeat) answered
+    - rfid:   reconnect RFID refresh answered for every slot
+    """
+
+    PHASES = ("probe", "open", "info", "status", "rfid")
+
+    def __init__(self, clock: Callable[[], float]):
+        self._clock = clock
+        self.t0: Optional[float] = None
+        self.units: List[int] = []
+        self._marks: Dict[int, Dict[str, float]] = {}
+
+    def start(self, units: Iterable[int]) -> None:
+        """Begin a new timeline at klippy:ready for the given unit numbers."""
+        self.t0 = self._clock()
+        self.units = sorted(units)
+        self._marks = {unit: {} for unit in self.units}
+
+    def mark(self, unit: int, phase: str) -> bool:
+        """Record ``phase`` for ``unit`` now; False if ignored or already set."""
+        if self.t0 is None or phase not in self.PHASES:
+            return False
+        marks = self._marks.setdefault(unit, {})
+        if phase in marks:
+            return False
+        marks[phase] = self._clock() - self.t0
+        return True
+
+    def elapsed(self, unit: int, phase: str) -> Optional[float]:
+        """Seconds from klippy:ready to ``phase`` for ``unit``, or None."""
+        return self._marks.get(unit, {}).get(phase)
+
+    def is_complete(self) -> bool:
+        """True once every unit has finished every phase."""
+        return bool(self.units) and all(
+            len(self._marks.get(unit, {})) == len(self.PHASES) for unit in self.units
+        )
+
+    def slowest_phase(self):
+        """(unit, phase, seconds spent in it) for the longest recorded phase."""
+        slowest = None
+        for unit in self.units:
+            previous = 0.0
+            for phase in self.PHASES:
+                at = self.elapsed(unit, phase)
+                if at is None:
+                    continue
+                spent = max(0.0, at - previous)
+                if slowest is None or spent > slowest[2]:
+                    slowest = (unit, phase, spent)
+                previous = at
+        return slowest
+
+    def format_report(self) -> List[str]:
+        """Render the timeline as a table of seconds after klippy:ready."""
+        if self.t0 is None:
+            return ["ACE startup: no startup recorded (ACE Pro disabled at klippy:ready?)"]
+
+        lines = ["=== ACE Startup (seconds after klippy:ready) ==="]
+        lines.append("unit    " + "".join(f"{phase:>8s}" for phase in self.PHASES))
+        for unit in self.units:
+            cells = []
+            for phase in self.PHASES:
+                at = self.elapsed(unit, phase)
+                cells.append(f"{at:8.2f}" if at is not None else f"{'-':>8s}")
+            lines.append(f"ACE[{unit}]  " + "".join(cells))
+
+        slowest = self.slowest_phase()
+        if slowest is not None:
+            unit, phase, spent = slowest
+            lines.append(f"Slowest phase: {phase} on ACE[{unit}] ({spent:.2f}s)")
+        if not self.is_complete():
+            lines.append("Startup still in progress ('-' = phase not reached yet)")
+        return lines
+
+    def snapshot(self) -> Dict[int, Dict[str, float]]:
+        """Return recorded phase times per unit."""
+        return {unit: dict(marks) for unit, marks in self._marks.items()}
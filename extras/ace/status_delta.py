@@ -0,0 +1,90 @@
+"""Change detection for periodic GET_STATUS results."""
+
+from __future__ import annotations
+
+from typing import Any, Dict, FrozenSet, Optional, Tuple
+
+
+class AceStatusDelta:
+    """
+    Compare each status result with the previous one from the same device.
+
+    An idle ACE answers every heartbeat with the same result, so consumers
+    can skip their per-slot reconciliation when nothing moved. update()
+    returns ``(changed, dirty_slots)``:
+
+    - ``changed`` is False when the result equals the previous one
+    - ``dirty_slots`` is the set of slot indices whose payload differs,
+      or None when every slot must be treated as dirty (first sample,
+      after reset(), or when the slot list is not in the usual shape)
+
+    Results are compared as decoded values rather than frame bytes: ACE1
+    frames embed the request id in the JSON payload, so two identical
+    statuses never have identical bytes. Dict equality stops at the first
+    differing field, which keeps the idle case cheap. Results exposing a
+    ``delta_key`` (ACE2 Ace2StatusResult, whose frames carry no request id
+    in the payload) are compared on that raw key instead.
+    """
+
+    def __init__(self):
+        self._header: Optional[Dict[str, Any]] = None
+        self._slots: Dict[int, Any] = {}
+        self.samples = 0
+        self.unchanged = 0
+
+    def reset(self) -> None:
+        """Forget the previous result; the next update() marks everything dirty."""
+        self._header = None
+        self._slots = {}
+
+    def update(self, result: Dict[str, Any]) -> Tuple[bool, Optional[FrozenSet[int]]]:
+        """Record ``result`` and report what changed since the previous one."""
+        self.samples += 1
+        if not isinstance(result, dict):
+            self.reset()
+            return True, None
+        delta_key = getattr(result, "delta_key", None)
+        if delta_key is not None:
+            # Lazily decoded result (ACE2): compare raw payloads, decode nothing
+            header, slot_payloads = delta_key
+            by_index = dict(enumerate(slot_payloads))
+        else:
+            header = {key: value for key, value in result.items() if key != "slots"}
+            by_index = self._index_slots(result.get("slots"))
+
+        first = self._header is None
+        header_changed = first or header != self._header
+        self._header = header
+        if by_index is None:
+            self._slots = {}
+            return True, None
+
+        previous = self._slots
+        self._slots = by_index
+        if first:
+            return True, None
+
+        dirty = frozenset(
+            idx for idx, slot in by_index.items() if previous.get(idx) != slot
+        ) | frozenset(idx for idx in previous if idx not in by_index)
+        if not dirty and not header_changed:
+            self.unchanged += 1
+            return False, dirty
+        return True, dirty
+
+    @staticmethod
+    def _index_slots(slots: Any) -> Optional[Dict[int, Any]]:
+        """Map slot index to slot dict, or None when the list is not in the usual shape."""
+        if not isinstance(slots, list):
+            return None
+        by_index = {}
+        for slot in slots:
+            idx = slot.get("index") if isinstance(slot, dict) else None
+            if idx is None or idx in by_index:
+                return None
+            by_index[idx] = slot
+        return by_index
+
+    def snapshot(self) -> Dict[str, int]:
+        """Return comparison counters for status reporting."""
+        return {"samples": self.samples, "unchanged": self.unchanged}
@@ -0,0 +1,232 @@
+"""Per-transport counters and latency histograms for link health reporting."""
+
+from __future__ import annotations
+
+import time
+from typing import Any, Callable, Dict, Optional
+
+# Upper bucket bounds in milliseconds; the last bucket is open-ended
+LATENCY_BUCKETS_MS = (5, 10, 20, 50, 100, 200, 500, 1000, 2000, 5000)
+
+
+class AceLatencyHistogram:
+    """
+    Fixed-bucket latency histogram with a drift indicator.
+
+    ``recent_ms`` is an exponentially weighted average over roughly the
+    last ``1 / RECENT_ALPHA`` samples. Compared with the lifetime average
+    it shows a link that is getting slower (a failing cable, a hub
+    dropping to full speed) long before requests start timing out.
+    """
+
+    RECENT_ALPHA = 0.05
+
+    __slots__ = ("counts", "count", "total_ms", "min_ms", "max_ms", "recent_ms")
+
+    def __init__(self):
+        self.counts = [0] * (len(LATENCY_BUCKETS_MS) + 1)
+        self.count = 0
+        self.total_ms = 0.0
+        self.min_ms: Optional[float] = None
+        self.max_ms = 0.0
+        self.recent_ms: Optional[float] = None
+
+    def observe(self, seconds: float) -> None:
+        ms = max(0.0, seconds * 1000.0)
+        index = 0
+        for bound in LATENCY_BUCKETS_MS:
+            if ms <= bound:
+                break
+            index += 1
+        self.counts[index] += 1
+        self.count += 1
+        self.total_ms += ms
+        if self.min_ms is None or ms < self.min_ms:
+            self.min_ms = ms
+        if ms > self.max_ms:
+            self.max_ms = ms
+        if self.recent_ms is None:
+            self.recent_ms = ms
+        else:
+            self.recent_ms += self.RECENT_ALPHA * (ms - self.recent_ms)
+
+    def percentile(self, fraction: float) -> Optional[float]:
+        """Upper bound (ms) of the bucket holding the given fraction of samples."""
+        if not self.count:
+            return None
+        target = fraction * self.count
+        seen = 0
+        for index, n in enumerate(self.counts):
+            seen += n
+            if seen >= target and n:
+                if index < len(LATENCY_BUCKETS_MS):
+                    return float(LATENCY_BUCKETS_MS[index])
+                return self.max_ms
+        return self.max_ms
+
+    def snapshot(self) -> Dict[str, Any]:
+        buckets = {f"le_{bound}ms": n for bound, n in zip(LATENCY_BUCKETS_MS, self.counts)}
+        buckets[f"gt_{LATENCY_BUCKETS_MS[-1]}ms"] = self.counts[-1]
+        return {
+            "count": self.count,
+            "avg_ms": self.total_ms / self.count if self.count else 0.0,
+            "min_ms": self.min_ms or 0.0,
+            "max_ms": self.max_ms,
+            "recent_ms": self.recent_ms or 0.0,
+            "p50_ms": self.percentile(0.5),
+            "p95_ms": self.percentile(0.95),
+            "buckets": buckets,
+        }
+
+
+class AceTransportMetrics:
+    """
+    Link health metrics for one serial transport.
+
+    Collected on the reactor thread by AceSerialManager:
+
+    - round-trip latency per command (histogram) and timeouts per command
+    - queue wait before a request got a window slot (histogram)
+    - in-flight window occupancy, time-weighted average and peak
+    - frames and bytes in each direction
+    - parser notices: CRC failures, resyncs, undecodable payloads
+    - frame decode time (CRC check and payload decode, per frame)
+
+    Decode time is recorded by the frame parser, which runs on the serial
+    I/O thread when one is used; it is the only writer of those fields.
+    The same holds for the tx counters, which that thread updates once a
+    write has succeeded.
+    """
+
+    def __init__(self, window_size: int, clock: Callable[[], float] = time.monotonic):
+        self.window_size = int(window_size)
+        self._clock = clock
+        self.rtt: Dict[str, AceLatencyHistogram] = {}
+        self.timeouts: Dict[str, int] = {}
+        self.queue_wait = AceLatencyHistogram()
+        self.tx_frames = 0
+        self.tx_bytes = 0
+        self.rx_frames = 0
+        self.rx_bytes = 0
+        self.crc_errors = 0
+        self.resyncs = 0
+        self.decode_errors = 0
+        self.other_notices = 0
+        self.decode_frames = 0
+        self.decode_seconds = 0.0
+        self.decode_max_s = 0.0
+        self._window_level = 0
+        self._window_peak = 0
+        self._window_area = 0.0
+        self._window_since: Optional[float] = None
+        self._window_last: Optional[float] = None
+
+    def record_rtt(self, command: str, seconds: float) -> None:
+        histogram = self.rtt.get(command)
+        if histogram is None:
+            histogram = self.rtt[command] = AceLatencyHistogram()
+        histogram.observe(seconds)
+
+    def record_timeout(self, command: Optional[str]) -> None:
+        command = command or "unknown"
+        self.timeouts[command] = self.timeouts.get(command, 0) + 1
+
+    def record_queue_wait(self, seconds: float) -> None:
+        self.queue_wait.observe(seconds)
+
+    def record_tx(self, nbytes: int) -> None:
+        self.tx_frames += 1
+        self.tx_bytes += nbytes
+
+    def record_rx(self, nbytes: int, frames: int = 0) -> None:
+        self.rx_bytes += nbytes
+        self.rx_frames += frames
+
+    def record_notice(self, notice: str) -> None:
+        """Classify one frame parser notice."""
+        if "CRC" in notice:
+            self.crc_errors += 1
+        elif "Resync" in notice or "resync" in notice:
+            self.resyncs += 1
+        elif "decode" in notice:
+            self.decode_errors += 1
+        else:
+            self.other_notices += 1
+
+    def record_decode(self, seconds: float) -> None:
+        """Record the time spent decoding one frame."""
+        self.decode_frames += 1
+        self.decode_seconds += seconds
+        if seconds > self.decode_max_s:
+            self.decode_max_s = seconds
+
+    def decode_average_us(self) -> float:
+        if not self.decode_frames:
+            return 0.0
+        return self.decode_seconds / self.decode_frames * 1e6
+
+    def set_window(self, inflight: int) -> None:
+        """Record the in-flight count after it changed."""
+        now = self._clock()
+        if self._window_last is None:
+            self._window_since = now
+        else:
+            self._window_area += self._window_level * max(0.0, now - self._window_last)
+        self._window_last = now
+        self._window_level = inflight
+        if inflight > self._window_peak:
+            self._window_peak = inflight
+
+    def window_average(self) -> float:
+        if self._window_since is None:
+            return 0.0
+        now = self._clock()
+        span = now - self._window_since
+        if span <= 0:
+            return float(self._window_level)
+        area = self._window_area + self._window_level * max(0.0, now - self._window_last)
+        return area / span
+
+    def summary(self) -> Dict[str, Any]:
+        """Compact figures for printer status objects (polled often)."""
+        count = sum(h.count for h in self.rtt.values())
+        total = sum(h.total_ms for h in self.rtt.values())
+        worst = max(self.rtt.values(), key=lambda h: h.recent_ms or 0.0, default=None)
+        return {
+            "rtt_avg_ms": round(total / count, 1) if count else 0.0,
+            "rtt_recent_max_ms": round(worst.recent_ms or 0.0, 1) if worst else 0.0,
+            "timeouts": sum(self.timeouts.values()),
+            "crc_errors": self.crc_errors,
+            "resyncs": self.resyncs,
+            "tx_bytes": self.tx_bytes,
+            "rx_bytes": self.rx_bytes,
+            "window_avg": round(self.window_average(), 2),
+            "decode_avg_us": round(self.decode_average_us(), 1),
+        }
+
+    def snapshot(self) -> Dict[str, Any]:
+        """Full metrics for ACE_GET_CONNECTION_STATUS."""
+        return {
+            "rtt": {command: h.snapshot() for command, h in sorted(self.rtt.items())},
+            "timeouts": dict(self.timeouts),
+            "queue_wait": self.queue_wait.snapshot(),
+            "window": {
+                "size": self.window_size,
+                "current": self._window_level,
+                "avg": self.window_average(),
+                "peak": self._window_peak,
+            },
+            "tx": {"frames": self.tx_frames, "bytes": self.tx_bytes},
+            "rx": {"frames": self.rx_frames, "bytes": self.rx_bytes},
+            "decode": {
+                "frames": self.decode_frames,
+                "avg_us": self.decode_average_us(),
+                "max_us": self.decode_max_s * 1e6,
+            },
+            "errors": {
+                "crc": self.crc_errors,
+                "resync": self.resyncs,
+                "decode": self.decode_errors,
+                "other": self.other_notices,
+            },
+        }
@@ -0,0 +1,93 @@
+"""Token-bucket byte budget for frames written to the ACE."""
+
+from __future__ import annotations
+
+from typing import Any, Dict
+
+
+class AceTxPacer:
+    """
+    Pace outgoing frames so the ACE input buffer is never overrun.
+
+    The ACE shares one ~1 KiB ring buffer between input and output;
+    writing more than that in a short span drops bytes (see PROTOCOL.md),
+    which shows up later as timeouts and unsolicited-response storms. The
+    bucket holds up to ``burst_bytes`` and refills at ``rate_bytes_s``. A
+    frame is sent only when the bucket holds its full length, except that
+    a frame larger than the bucket may go once the bucket is full so it
+    cannot stall forever.
+
+    A rate of 0 disables pacing.
+    """
+
+    def __init__(self, rate_bytes_s: float, burst_bytes: int):
+        self.rate_bytes_s = max(0.0, float(rate_bytes_s))
+        self.burst_bytes = max(1, int(burst_bytes))
+        self._tokens = float(self.burst_bytes)
+        self._last = None
+        self.frames_sent = 0
+        self.bytes_sent = 0
+        self.paced_frames = 0
+        self.paced_delay_s = 0.0
+        self.max_delay_s = 0.0
+
+    @property
+    def enabled(self) -> bool:
+        return self.rate_bytes_s > 0.0
+
+    def _refill(self, now: float) -> None:
+        if self._last is not None and now > self._last:
+            self._tokens = min(
+                float(self.burst_bytes),
+                self._tokens + (now - self._last) * self.rate_bytes_s,
+            )
+        self._last = now
+
+    def reserve(self, nbytes: int, now: float) -> float:
+        """
+        Take ``nbytes`` from the budget if available.
+
+        Returns:
+            0.0 if the frame may be written now (budget consumed), otherwise
+            the delay in seconds until it fits; nothing is consumed then.
+        """
+        if not self.enabled:
+            self.frames_sent += 1
+            self.bytes_sent += nbytes
+            return 0.0
+
+        self._refill(now)
+        needed = min(float(nbytes), float(self.burst_bytes))
+        if self._tokens + 1e-9 < needed:
+            return (needed - self._tokens) / self.rate_bytes_s
+
+        self._tokens -= nbytes
+        self.frames_sent += 1
+        self.bytes_sent += nbytes
+        return 0.0
+
+    def record_paced(self, held_s: float) -> None:
+        """Count a frame that was held back for ``held_s`` before sending."""
+        self.paced_frames += 1
+        self.paced_delay_s += held_s
+        if held_s > self.max_delay_s:
+            self.max_delay_s = held_s
+
+    def reset(self) -> None:
+        """Refill the bucket, e.g. after reconnecting to an idle device."""
+        self._tokens = float(self.burst_bytes)
+        self._last = None
+
+    def snapshot(self) -> Dict[str, Any]:
+        """Return pacing configuration and counters for status reporting."""
+        return {
+            "enabled": self.enabled,
+            "rate_bytes_s": self.rate_bytes_s,
+            "burst_bytes": self.burst_bytes,
+            "tokens": max(0.0, self._tokens),
+            "frames_sent": self.frames_sent,
+            "bytes_sent": self.bytes_sent,
+            "paced_frames": self.paced_frames,
+            "paced_delay_s": self.paced_delay_s,
+            "max_delay_s": self.max_delay_s,
+        }
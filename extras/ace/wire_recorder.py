@@ -0,0 +1,365 @@
+"""Binary capture of serial wire traffic and deterministic replay."""
+
+from __future__ import annotations
+
+import logging
+import os
+import struct
+import threading
+import time
+from typing import Any, Callable, Dict, Iterable, List, NamedTuple, Optional, Tuple
+
+from .protocol import AceFrameParser
+from .transport_metrics import AceTransportMetrics
+
+WIRE_LOG_MAGIC = b"ACEWIRE1"
+WIRE_RECORD = struct.Struct("<BdI")  # kind, monotonic seconds, payload length
+
+WIRE_TX = 1     # one outbound frame as written
+WIRE_RX = 2     # one raw inbound chunk as read (frame boundaries not preserved)
+WIRE_EVENT = 3  # utf-8 marker text ("connect ...", "disconnect")
+
+WIRE_KIND_NAMES = {WIRE_TX: "tx", WIRE_RX: "rx", WIRE_EVENT: "event"}
+
+
+class AceWireRecord(NamedTuple):
+    kind: int
+    timestamp: float
+    data: bytes
+
+
+class AceWireRecorder:
+    """
+    Append serial traffic to a compact binary log with size-capped rotation.
+
+    File layout: ``ACEWIRE1``, a u16 length and the protocol name, then
+    records of ``kind (u8) | monotonic time (f64) | length (u32) | bytes``,
+    all little-endian. Once a file would grow past ``max_bytes`` it is
+    renamed to ``<path>.1`` (older files shift up to ``<path>.<backups>``,
+    the oldest is deleted) and a fresh file is started. An existing log is
+    rotated away on open so each session starts in its own file.
+
+    Recording is best effort: the first write error is logged and the
+    recorder disables itself rather than disturbing the serial link. All
+    methods are thread-safe (the serial I/O thread records rx chunks).
+    Buffered records are flushed at most ``FLUSH_INTERVAL_S`` after they
+    are written (the heartbeat keeps traffic flowing while connected), so
+    a killed klippy loses seconds of capture, not the whole buffer. After
+    close() further records are dropped instead of reopening the log.
+    """
+
+    FLUSH_INTERVAL_S = 2.0
+
+    def __init__(
+            self,
+            path: str,
+            protocol_name: str,
+            max_bytes: int = 1024 * 1024,
+            backups: int = 2,
+            clock: Callable[[], float] = time.monotonic):
+        self.path = path
+        self.protocol_name = protocol_name
+        self.max_bytes = max(4096, int(max_bytes))
+        self.backups = max(0, int(backups))
+        self._clock = clock
+        self._lock = threading.Lock()
+        self._file = None
+        self._size = 0
+        self._last_flush = 0.0
+        self._closed = False
+        self.enabled = True
+        self.records = 0
+        self.bytes_written = 0
+        self.rotations = 0
+
+    def _header(self) -> bytes:
+        name = self.protocol_name.encode("utf-8")
+        return WIRE_LOG_MAGIC + struct.pack("<H", len(name)) + name
+
+    def _rotate(self) -> None:
+        if self._file is not None:
+            self._file.close()
+            self._file = None
+        if os.path.exists(self.path):
+            if self.backups:
+                for n in range(self.backups - 1, 0, -1):
+                    older = f"{self.path}.{n}"
+                    if os.path.exists(older):
+                        os.replace(older, f"{self.path}.{n + 1}")
+                os.replace(self.path, f"{self.path}.1")
+            else:
+                os.remove(self.path)
+            self.rotations += 1
+        self._open_fresh()
+
+    def _open_fresh(self) -> None:
+        directory = os.path.dirname(self.path)
+        if directory:
+            os.makedirs(directory, exist_ok=True)
+        self._file = open(self.path, "wb")
+        header = self._header()
+        self._file.write(header)
+        self._size = len(header)
+
+    def _write(self, kind: int, data: bytes) -> None:
+        if not self.enabled:
+            return
+        timestamp = self._clock()
+        with self._lock:
+            if self._closed:
+                return
+            try:
+                if self._file is None:
+                    self._rotate()
+                record_len = WIRE_RECORD.size + len(data)
+                if self._size + record_len > self.max_bytes and self._size > len(self._header()):
+                    self._rotate()
+                self._file.write(WIRE_RECORD.pack(kind, timestamp, len(data)))
+                self._file.write(data)
+                self._size += record_len
+                self.records += 1
+                self.bytes_written += record_len
+                if timestamp - self._last_flush >= self.FLUSH_INTERVAL_S:
+                    self._file.flush()
+                    self._last_flush = timestamp
+            except Exception as e:
+                self.enabled = False
+                logging.warning(f"ACE wire recorder: disabled after write error on {self.path}: {e}")
+
+    def record_tx(self, data: bytes) -> None:
+        self._write(WIRE_TX, bytes(data))
+
+    def record_rx(self, data: bytes) -> None:
+        self._write(WIRE_RX, bytes(data))
+
+    def record_event(self, text: str) -> None:
+        self._write(WIRE_EVENT, text.encode("utf-8"))
+
+    def flush(self) -> None:
+        with self._lock:
+            if self._file is not None:
+                try:
+                    self._file.flush()
+                except Exception:
+                    pass
+
+    def close(self) -> None:
+        with self._lock:
+            self._closed = True
+            if self._file is not None:
+                try:
+                    self._file.close()
+                except Exception:
+                    pass
+                self._file = None
+
+    def snapshot(self) -> Dict[str, Any]:
+        """Return recorder state for status reporting."""
+        return {
+            "path": self.path,
+            "enabled": self.enabled,
+            "records": self.records,
+            "bytes": self.bytes_written,
+            "rotations": self.rotations,
+        }
+
+
+def create_wire_recorder(ace_config, name: str, protocol_name: str) -> Optional[AceWireRecorder]:
+    """Build the recorder for one transport from ``wire_log_*`` options, or None."""
+    directory = (ace_config.get("wire_log_dir") or "").strip()
+    if not directory:
+        return None
+    return AceWireRecorder(
+        os.path.join(os.path.expanduser(directory), f"{name}_{protocol_name}.acewire"),
+        protocol_name,
+        max_bytes=int(ace_config.get("wire_log_max_kb", 1024)) * 1024,
+        backups=ace_config.get("wire_log_backups", 2),
+    )
+
+
+def read_wire_log(path: str) -> Tuple[str, List[AceWireRecord]]:
+    """
+    Load one wire log file.
+
+    Returns:
+        (protocol name, records). A truncated final record (klippy killed
+        mid-write) is dropped.
+    """
+    with open(path, "rb") as f:
+        blob = f.read()
+    if not blob.startswith(WIRE_LOG_MAGIC):
+        raise ValueError(f"{path}: not an ACE wire log")
+    pos = len(WIRE_LOG_MAGIC)
+    (name_len,) = struct.unpack_from("<H", blob, pos)
+    pos += 2
+    protocol_name = blob[pos:pos + name_len].decode("utf-8")
+    pos += name_len
+
+    records = []
+    end = len(blob)
+    while pos + WIRE_RECORD.size <= end:
+        kind, timestamp, length = WIRE_RECORD.unpack_from(blob, pos)
+        pos += WIRE_RECORD.size
+        if pos + length > end:
+            break
+        records.append(AceWireRecord(kind, timestamp, blob[pos:pos + length]))
+        pos += length
+    return protocol_name, records
+
+
+class AceReplayReactor:
+    """Reactor stand-in whose clock is set by the replay driver; timers never fire."""
+
+    NOW = 0.0
+    NEVER = 9999999999999999.0
+
+    def __init__(self):
+        self.now = 0.0
+
+    def monotonic(self) -> float:
+        return self.now
+
+    def register_timer(self, callback, waketime=NEVER):
+        return callback
+
+    def update_timer(self, timer, waketime) -> None:
+        pass
+
+    def unregister_timer(self, timer) -> None:
+        pass
+
+    def register_async_callback(self, callback, waketime=NOW) -> None:
+        pass
+
+    def pause(self, waketime) -> float:
+        self.now = max(self.now, waketime)
+        return self.now
+
+
+class _ReplayGcode:
+    def __init__(self):
+        self.messages: List[str] = []
+
+    def respond_info(self, msg: str) -> None:
+        self.messages.append(msg)
+
+
+class AceWireReplay:
+    """
+    Feed a recorded session through the serial manager's receive path.
+
+    Every tx frame is decoded to register its request id as in flight (at
+    the recorded send time); every rx chunk is handed to
+    ``_process_serial_input`` with the simulated reactor clock at the
+    recorded read time. Parsing, resync, ``dispatch_response`` matching
+    and RTT accounting therefore run exactly as they did live, on the same
+    byte boundaries, without a device or a running reactor.
+
+    ``run()`` returns counts that regression tests can pin, the transport
+    metrics computed on the recorded clock, and the wall time spent in the
+    receive path (``parse_seconds``, and per-frame ``decode`` timing) for
+    benchmarking parser changes.
+    """
+
+    def __init__(self, protocol, records: Iterable[AceWireRecord], serial_manager_factory=None):
+        self.protocol = protocol
+        self.records = list(records)
+        self.reactor = AceReplayReactor()
+        self.gcode = _ReplayGcode()
+        if serial_manager_factory is None:
+            from .serial_manager import AceSerialManager
+            serial_manager_factory = AceSerialManager
+        self.manager = serial_manager_factory(
+            self.gcode,
+            self.reactor,
+            instance_num=0,
+            supervision_enabled=False,
+            protocol=protocol,
+            hotplug=False,
+        )
+        self.manager.unsolicited_response_callback = self._on_unsolicited
+        # Window occupancy on the recorded clock rather than the wall clock
+        self.manager.metrics = AceTransportMetrics(
+            self.manager.WINDOW_SIZE, clock=self.reactor.monotonic
+        )
+        self._tx_parser = AceFrameParser(protocol, self.manager._calc_crc)
+        self.counts = {
+            "tx_frames": 0,
+            "tx_undecoded": 0,
+            "rx_chunks": 0,
+            "rx_bytes": 0,
+            "solicited": 0,
+            "unsolicited": 0,
+            "events": 0,
+            "dropped_on_disconnect": 0,
+        }
+
+    def _on_unsolicited(self, response) -> bool:
+        self.counts["unsolicited"] += 1
+        return True
+
+    def _on_response(self, response=None) -> None:
+        self.counts["solicited"] += 1
+
+    def _register_tx(self, data: bytes, timestamp: float) -> None:
+        self.counts["tx_frames"] += 1
+        parser = self._tx_parser
+        parser.reset(data)
+        try:
+            requests, _ = parser.parse()
+        except Exception:
+            requests = []
+        if not requests:
+            self.counts["tx_undecoded"] += 1
+            return
+        manager = self.manager
+        for request in requests:
+            rid = request.get("id")
+            if rid is None:
+                continue
+            with manager._lock:
+                manager._callback_map[rid] = self._on_response
+                manager.inflight[rid] = timestamp
+                manager._inflight_commands[rid] = self.protocol.get_request_command_name(request)
+                manager.metrics.set_window(len(manager.inflight))
+
+    def run(self) -> Dict[str, Any]:
+        """Replay every record once; returns counts, metrics and timings."""
+        manager = self.manager
+        parse_seconds = 0.0
+        for record in self.records:
+            self.reactor.now = record.timestamp
+            if record.kind == WIRE_TX:
+                self._register_tx(record.data, record.timestamp)
+            elif record.kind == WIRE_RX:
+                self.counts["rx_chunks"] += 1
+                self.counts["rx_bytes"] += len(record.data)
+                t0 = time.perf_counter()
+                manager._process_serial_input(record.data)
+                parse_seconds += time.perf_counter() - t0
+            elif record.kind == WIRE_EVENT:
+                self.counts["events"] += 1
+                if record.data.startswith(b"connect"):
+                    manager._reset_frame_parser()
+                elif record.data.startswith(b"disconnect"):
+                    # As live: requests in flight at the drop never get answers
+                    self.counts["dropped_on_disconnect"] += len(manager.inflight)
+                    manager._reset_frame_parser()
+                    manager.clear_queues()
+
+        span = 0.0
+        if self.records:
+            span = self.records[-1].timestamp - self.records[0].timestamp
+        metrics = manager.metrics.snapshot()
+        result = dict(self.counts)
+        result.update({
+            "unanswered": len(manager.inflight),
+            "notices": [msg for msg in self.gcode.messages if "UNSOLICITED" not in msg],
+            "recorded_seconds": span,
+            "parse_seconds": parse_seconds,
+            # Wall-clock decode timing is kept beside parse_seconds, out of
+            # the metrics that replays of the same capture must reproduce
+            "decode": metrics.pop("decode"),
+            "metrics": metrics,
+        })
+        return result
@@ -0,0 +1,252 @@
+"""Tests for the pty-based ACE simulator in tools/ace_simulator.py."""
+
+import importlib.util
+import json
+import os
+import struct
+import threading
+import time
+
+import pytest
+
+from ace.crc import crc16_mcrf4xx
+from ace.protocol import AceFrameParser
+from ace.protocol_ace1 import AceJsonProtocolAdapter
+from ace.protocol_ace2 import AceProtoProtocolAdapter
+from ace.serial_io_thread import AceSerialIoThread
+
+_SIM_PATH = os.path.join(os.path.dirname(__file__), "..", "tools", "ace_simulator.py")
+_spec = importlib.util.spec_from_file_location("ace_simulator", _SIM_PATH)
+ace_simulator = importlib.util.module_from_spec(_spec)
+_spec.loader.exec_module(ace_simulator)
+
+AceSimulator = ace_simulator.AceSimulator
+AceSimFaults = ace_simulator.AceSimFaults
+
+
+def _ace1_request(request_id, method, params=None):
+    request = {"id": request_id, "method": method}
+    if params:
+        request["params"] = params
+    return AceJsonProtocolAdapter().serialize_request_frame(request, crc16_mcrf4xx)
+
+
+def _ace2_request(request, request_id, device_id=None):
+    request = dict(request, id=request_id)
+    if device_id is not None:
+        request["target_device_id"] = device_id
+    return AceProtoProtocolAdapter().serialize_request_frame(request, crc16_mcrf4xx)
+
+
+def _drain(sim, now):
+    """Run the simulator until every queued response is written; return frames."""
+    written = []
+    sim.write = lambda data: written.append(data)
+    for _ in range(100):
+        sim.step(now)
+        if not sim._requests and not sim._out:
+            break
+        now += 0.01
+    return b"".join(written)
+
+
+def _parse(adapter, data):
+    parser = AceFrameParser(adapter, crc16_mcrf4xx)
+    parser.append(data)
+    return parser.parse()
+
+
+class TestAce1Simulation:
+    """One ACE1 unit, driven without a pty."""
+
+    def setup_method(self):
+        self.sim = AceSimulator(latency=0.0)
+        self.adapter = AceJsonProtocolAdapter()
+
+    def _call(self, request_id, method, params=None, now=0.0):
+        self.sim.receive(_ace1_request(request_id, method, params), now)
+        responses, notices = _parse(self.adapter, _drain(self.sim, now))
+        assert notices == []
+        return responses
+
+    def test_status_and_info(self):
+        status = self._call(1, "get_status")[0]
+        info = self._call(2, "get_info")[0]
+
+        assert status["id"] == 1
+        assert status["result"]["status"] == "ready"
+        assert len(status["result"]["slots"]) == 4
+        assert info["result"]["model"] == "Anycubic Color Engine Pro"
+
+    def test_feed_keeps_unit_busy_for_length_over_speed(self):
+        self._call(1, "feed_filament", {"index": 2, "length": 50, "speed": 25}, now=10.0)
+
+        busy = self._call(2, "get_status", now=11.0)[0]["result"]
+        ready = self._call(3, "get_status", now=12.1)[0]["result"]
+
+        assert (busy["status"], busy["action"]) == ("busy", "feeding")
+        assert (ready["status"], ready["action"]) == ("ready", "none")
+
+    def test_stop_ends_motion_early(self):
+        self._call(1, "unwind_filament", {"index": 0, "length": 500, "speed": 10}, now=0.0)
+        self._call(2, "stop_unwind_filament", {"index": 0}, now=1.0)
+
+        assert self._call(3, "get_status", now=1.1)[0]["result"]["status"] == "ready"
+
+    def test_unknown_method_returns_error_code(self):
+        assert self._call(1, "self_destruct")[0]["code"] != 0
+
+    def test_shared_buffer_drops_bytes_when_full(self):
+        sim = AceSimulator(latency=0.5)
+        burst = b"".join(_ace1_request(i, "get_status") for i in range(60))
+
+        sim.receive(burst, 0.0)
+
+        assert len(burst) > 1024
+        assert sim.counters["bytes_dropped"] == len(burst) - 1024
+        assert sim.counters["requests"] < 60
+
+    def test_oversized_frame_freezes_unit(self):
+        self.sim.receive(b"\xFF\xAA" + struct.pack("<H", 2000) + b"{", 0.0)
+        self.sim.receive(_ace1_request(1, "get_status"), 0.1)
+
+        assert self.sim.frozen
+        assert self.sim.counters["oversize_freezes"] == 1
+        assert _drain(self.sim, 0.2) == b""
+
+    def test_stalled_partial_frame_is_discarded(self):
+        sim = AceSimulator(latency=0.0, faults=AceSimFaults(reset_on_stall=False))
+        frame = _ace1_request(1, "get_status")
+        sim.receive(frame[:6], 0.0)
+
+        sim.step(3.5)
+        sim.receive(_ace1_request(2, "get_status"), 3.6)
+        responses, _ = _parse(self.adapter, _drain(sim, 3.6))
+
+        assert sim.counters["stalled_frames"] == 1
+        assert [r["id"] for r in responses] == [2]
+
+    def test_injected_crc_errors_are_seen_by_the_driver_parser(self):
+        sim = AceSimulator(latency=0.0, faults=AceSimFaults(crc_error_rate=1.0), seed=1)
+        sim.receive(_ace1_request(1, "get_status"), 0.0)
+
+        responses, notices = _parse(self.adapter, _drain(sim, 0.0))
+
+        assert responses == []
+        assert notices == ["Invalid CRC"]
+
+    def test_dropped_requests_get_no_answer(self):
+        sim = AceSimulator(latency=0.0, faults=AceSimFaults(drop_rate=1.0), seed=1)
+        sim.receive(_ace1_request(1, "get_status"), 0.0)
+
+        assert _drain(sim, 0.0) == b""
+        assert sim.counters["requests_dropped"] == 1
+
+
+class TestAce2BusSimulation:
+    """Several ACE2 units sharing one bus."""
+
+    def setup_method(self):
+        self.sim = AceSimulator(protocol="ace2_proto", units=2, latency=0.0)
+        self.adapter = AceProtoProtocolAdapter()
+
+    def _call(self, frame, now=0.0):
+        self.sim.receive(frame, now)
+        responses, notices = _parse(self.adapter, _drain(self.sim, now))
+        assert notices == []
+        return responses
+
+    def test_discover_then_assign_then_address(self):
+        discover = self.adapter.build_discover_device_request()
+        uids = []
+        for rid in (1, 2):
+            result = self._call(_ace2_request(discover, rid))[0]["result"]
+            uids.append((result["uid1"], result["uid2"], result["uid3"]))
+        assert len(set(uids)) == 2
+
+        for device_id, uid in enumerate(uids, start=1):
+            ack = self._call(_ace2_request(self.adapter.build_assign_device_id_request(*uid, device_id), 10 + device_id))
+            assert ack[0]["code"] == 0
+
+        status = self._call(_ace2_request(self.adapter.build_get_status_request(), 20, device_id=2))[0]
+        assert status["device_id"] == 2
+        assert status["result"]["status"] == "ready"
+        assert [slot["status"] for slot in status["result"]["slots"]] == ["ready"] * 4
+
+        info = self._call(_ace2_request(self.adapter.build_get_filament_info_request(1), 21, device_id=1))[0]
+        assert info["result"]["type"] == "PETG"
+
+    def test_unassigned_device_id_is_not_answered(self):
+        assert self._call(_ace2_request(self.adapter.build_get_status_request(), 1, device_id=5)) == []
+
+    def test_feed_assist_reports_busy(self):
+        self.sim.units[0].device_id = 1
+        self._call(_ace2_request(self.adapter.build_start_feed_assist_request(0), 1, device_id=1))
+
+        status = self._call(_ace2_request(self.adapter.build_get_status_request(), 2, device_id=1))[0]
+
+        assert status["result"]["status"] == "busy"
+        assert status["result"]["slots"][0]["status_detail"] == "assisting"
+
+
+class PtyPort:
+    """Serial stand-in over the simulator's pty slave."""
+
+    def __init__(self, path):
+        import termios
+        import tty
+        self.fd = os.open(path, os.O_RDWR | os.O_NOCTTY)
+        tty.setraw(self.fd)
+        termios.tcflush(self.fd, termios.TCIOFLUSH)
+
+    def fileno(self):
+        return self.fd
+
+    def read(self, size=1):
+        return os.read(self.fd, size)
+
+    def write(self, data):
+        os.write(self.fd, data)
+
+    def close(self):
+        os.close(self.fd)
+
+
+class TestPtyEndToEnd:
+    """Real framing and timing through a pseudo-terminal and the I/O thread."""
+
+    def test_requests_round_trip_through_io_thread(self, tmp_path):
+        sim = AceSimulator(latency=0.005, link=str(tmp_path / "ttyACE0"))
+        sim.start()
+        port = PtyPort(sim.path)
+        events = []
+        done = threading.Event()
+
+        def wake():
+            done.set()
+
+        io_thread = AceSerialIoThread(port, AceFrameParser(AceJsonProtocolAdapter(), crc16_mcrf4xx), wake)
+        io_thread.start()
+        sent = 0
+        try:
+            deadline = time.monotonic() + 5.0
+            while time.monotonic() < deadline and len(events) < 20:
+                # One request in flight, as the device's shared buffer expects
+                if sent == len(events):
+                    sent += 1
+                    io_thread.send(sent, _ace1_request(sent, "get_status"))
+                done.wait(0.1)
+                done.clear()
+                io_thread.acknowledge_wake()
+                while io_thread.rx:
+                    events.append(io_thread.rx.popleft())
+        finally:
+            # The thread closes the port on its way out; closing it here too
+            # would double-close the pty fd
+            io_thread.stop()
+            assert io_thread.join(timeout=2.0)
+            sim.stop()
+
+        assert [kind for kind, *_ in events] == ["response"] * 20
+        assert sorted(event[1]["id"] for event in events) == list(range(1, 21))
+        assert not os.path.exists(tmp_path / "ttyACE0")
@@ -0,0 +1,266 @@
+"""Throughput benchmarks for the ACE wire codec and response path.
+
+Run only these with ``pytest -m benchmark -s`` to see the timings; they
+also assert that every frame survives the trip through the parser.
+"""
+
+import json
+import struct
+import time
+
+import pytest
+
+from ace.ace2_bus import Ace2BusSession
+from ace.crc import (
+    crc16_mcrf4xx,
+    crc16_mcrf4xx_fast,
+    crc16_mcrf4xx_reference,
+    crc16_mcrf4xx_table,
+)
+from ace.protocol_ace1 import AceJsonProtocolAdapter
+from ace.protocol_ace2 import AceProtoProtocolAdapter
+
+
+FRAME_COUNT = 10000
+CHUNK_SIZE = 64
+CRC_ITERATIONS = 2000
+
+_calc_crc = crc16_mcrf4xx
+
+
+def _pb_varint(value):
+    encoded = bytearray()
+    while value > 0x7F:
+        encoded.append((value & 0x7F) | 0x80)
+        value >>= 7
+    encoded.append(value & 0x7F)
+    return bytes(encoded)
+
+
+def _pb_uint(field, value):
+    return _pb_varint((field << 3) | 0) + _pb_varint(value)
+
+
+def _pb_bytes(field, payload):
+    return _pb_varint((field << 3) | 2) + _pb_varint(len(payload)) + payload
+
+
+def _ace1_status_frame(request_id):
+    payload = json.dumps({
+        "id": request_id,
+        "code": 0,
+        "msg": "success",
+        "result": {
+            "status": "ready",
+            "dryer_status": {"status": "stop", "target_temp": 0, "duration": 0, "remain_time": 0},
+            "temp": 28,
+            "enable_rfid": 1,
+            "fan_speed": 7000,
+            "feed_assist_count": 0,
+            "cont_assist_time": 0.0,
+            "slots": [
+                {"index": i, "status": "ready", "sku": "", "type": "PLA", "color": [255, 255, 255], "rfid": 2}
+                for i in range(4)
+            ],
+        },
+    }).encode("utf-8")
+    return (
+        b"\xFF\xAA" + struct.pack("<H", len(payload)) + payload
+        + struct.pack("<H", _calc_crc(payload)) + b"\xFE"
+    )
+
+
+def _ace2_status_frame(request_id):
+    dry_status = _pb_uint(1, 0) + _pb_uint(2, 0)
+    payload = _pb_uint(1, 1) + _pb_bytes(2, dry_status) + _pb_uint(3, 28) + _pb_uint(4, 40)
+    for slot in range(4):
+        payload += _pb_bytes(9, _pb_uint(1, 0) + _pb_uint(2, 2))
+    inner = b"\x81" + struct.pack("<H", request_id & 0xFFFF) + b"\x06" + bytes([len(payload)]) + payload
+    return b"\xFF\xAA" + inner + struct.pack("<H", _calc_crc(inner)) + b"\xFE"
+
+
+def _report(label, frames, elapsed):
+    rate = frames / elapsed if elapsed > 0 else float("inf")
+    print(f"\n{label}: {frames} frames in {elapsed * 1000:.1f} ms ({rate:,.0f} frames/s)")
+
+
+ADAPTERS = [
+    pytest.param(AceJsonProtocolAdapter, _ace1_status_frame, id="ace1"),
+    pytest.param(AceProtoProtocolAdapter, _ace2_status_frame, id="ace2"),
+]
+
+
+@pytest.mark.benchmark
+class TestCodecBenchmark:
+    """Feed 10k back-to-back status frames through each adapter."""
+
+    @pytest.mark.parametrize("adapter_cls,make_frame", ADAPTERS)
+    def test_single_buffer_back_to_back(self, adapter_cls, make_frame):
+        adapter = adapter_cls()
+        stream = b"".join(make_frame(i) for i in range(FRAME_COUNT))
+
+        start = time.perf_counter()
+        responses, remaining, notices = adapter.extract_responses(bytearray(stream), _calc_crc)
+        _report(f"{adapter_cls.__name__} single buffer", len(responses), time.perf_counter() - start)
+
+        assert len(responses) == FRAME_COUNT
+        assert remaining == bytearray()
+        assert notices == []
+
+    @pytest.mark.parametrize("adapter_cls,make_frame", ADAPTERS)
+    def test_incremental_chunks(self, adapter_cls, make_frame):
+        adapter = adapter_cls()
+        parser = adapter.create_frame_parser(_calc_crc)
+        stream = b"".join(make_frame(i) for i in range(FRAME_COUNT))
+        count = 0
+
+        start = time.perf_counter()
+        for pos in range(0, len(stream), CHUNK_SIZE):
+            parser.append(stream[pos:pos + CHUNK_SIZE])
+            responses, notices = parser.parse()
+            count += len(responses)
+        _report(f"{adapter_cls.__name__} {CHUNK_SIZE}-byte chunks", count, time.perf_counter() - start)
+
+        assert count == FRAME_COUNT
+        assert len(parser) == 0
+
+    @pytest.mark.parametrize("adapter_cls,make_frame", ADAPTERS)
+    def test_junk_and_resync(self, adapter_cls, make_frame):
+        adapter = adapter_cls()
+        parts = []
+        for i in range(FRAME_COUNT):
+            frame = make_frame(i)
+            if i % 10 == 5:
+                # Corrupt the tail so the parser must hunt for the next header
+                frame = frame[:-1] + b"\x00"
+            parts.append(b"\x00\x13junk" + frame)
+        stream = b"".join(parts)
+
+        start = time.perf_counter()
+        responses, remaining, notices = adapter.extract_responses(bytearray(stream), _calc_crc)
+        _report(f"{adapter_cls.__name__} junk/resync", len(responses), time.perf_counter() - start)
+
+        assert len(responses) == FRAME_COUNT - FRAME_COUNT // 10
+        assert remaining == bytearray()
+        assert notices.count("Invalid frame tail, resyncing") == FRAME_COUNT // 10
+
+
+@pytest.mark.benchmark
+class TestCrcBenchmark:
+    """Compare CRC implementations on a typical ACE1 status payload."""
+
+    @pytest.mark.parametrize("impl", [
+        crc16_mcrf4xx_reference,
+        crc16_mcrf4xx_table,
+        crc16_mcrf4xx_fast,
+    ], ids=["reference", "table", "binascii"])
+    def test_crc_throughput(self, impl):
+        payload = _ace1_status_frame(1)[4:-3]
+
+        start = time.perf_counter()
+        for _ in range(CRC_ITERATIONS):
+            crc = impl(payload)
+        elapsed = time.perf_counter() - start
+        mb_per_s = CRC_ITERATIONS * len(payload) / elapsed / 1e6 if elapsed > 0 else float("inf")
+        print(f"\nCRC {impl.__name__}: {len(payload)}-byte payload x{CRC_ITERATIONS} "
+              f"in {elapsed * 1000:.1f} ms ({mb_per_s:.1f} MB/s)")
+
+        assert crc == crc16_mcrf4xx_reference(payload)
+
+
+@pytest.mark.benchmark
+class TestFrameRoundTripBenchmark:
+    """Full request encode per protocol; decode is covered by TestCodecBenchmark."""
+
+    @pytest.mark.parametrize("adapter_cls,routing", [
+        pytest.param(AceJsonProtocolAdapter, {}, id="ace1"),
+        pytest.param(AceProtoProtocolAdapter, {"target_device_id": 1}, id="ace2"),
+    ])
+    def test_encode_throughput(self, adapter_cls, routing):
+        adapter = adapter_cls()
+        request = adapter.build_get_status_request()
+        request.update(routing)
+
+        start = time.perf_counter()
+        for request_id in range(FRAME_COUNT):
+            request["id"] = request_id
+            frame = adapter.serialize_request_frame(request, _calc_crc)
+        _report(f"{adapter_cls.__name__} encode get_status", FRAME_COUNT, time.perf_counter() - start)
+
+        assert frame[:2] == b"\xFF\xAA"
+        assert frame[-1] == 0xFE
+
+
+@pytest.mark.benchmark
+class TestAce2PayloadDecodeBenchmark:
+    """Generated GET_STATUS decoder against the generic field-dict reference."""
+
+    @pytest.mark.parametrize("method", [
+        "_decode_response_payload",
+        "_decode_response_payload_reference",
+    ], ids=["generated", "reference"])
+    def test_status_payload_decode(self, method):
+        adapter = AceProtoProtocolAdapter()
+        decode = getattr(adapter, method)
+        payload = _ace2_status_frame(1)[7:-3]
+
+        start = time.perf_counter()
+        for _ in range(FRAME_COUNT):
+            decoded = decode("GET_STATUS", payload)
+        _report(f"ACE2 GET_STATUS payload {method}", FRAME_COUNT, time.perf_counter() - start)
+
+        assert len(decoded["result"]["slots"]) == 4
+        assert decoded["result"]["temp"] == 28
+
+
+def _linear_device_for_device_id(session, device_id):
+    """The scan get_device_for_device_id used before the session kept an index."""
+    for device in session.iter_discovered_devices():
+        if device.device_id == device_id:
+            return device
+    return None
+
+
+@pytest.mark.benchmark
+class TestAce2BusLookupBenchmark:
+    """Shared-bus response demultiplexing (device id -> unit) by daisy-chain length."""
+
+    LOOKUPS = 20000
+
+    @staticmethod
+    def _session(units):
+        session = Ace2BusSession(port="/dev/null")
+        for n in range(units):
+            session.bind_logical_instance(n, 1000 + n, n, n)
+        session.build_assignment_plan()
+        return session
+
+    def _time_lookups(self, session, lookup, units):
+        start = time.perf_counter()
+        for n in range(self.LOOKUPS):
+            device = lookup(session, units - (n % units))
+        elapsed = time.perf_counter() - start
+        assert device.device_id == units - ((self.LOOKUPS - 1) % units)
+        return elapsed
+
+    @pytest.mark.parametrize("units", [1, 4, 16, 64])
+    def test_device_id_lookup(self, units):
+        session = self._session(units)
+        indexed = self._time_lookups(session, Ace2BusSession.get_device_for_device_id, units)
+        scan = self._time_lookups(session, _linear_device_for_device_id, units)
+        _report(f"ACE2 bus lookup, {units} units, indexed", self.LOOKUPS, indexed)
+        _report(f"ACE2 bus lookup, {units} units, linear scan", self.LOOKUPS, scan)
+
+    def test_lookup_does_not_scan_the_chain(self):
+        """Structural check (no wall-clock ratio): lookups never walk the device list."""
+        session = self._session(64)
+
+        class _NoScan(dict):
+            def _scan(self, *args):
+                raise AssertionError("lookup scanned every device")
+            __iter__ = values = items = _scan
+
+        session._devices_by_identity = _NoScan(session._devices_by_identity)
+        for n in range(64):
+            assert session.get_device_for_device_id(64 - n).device_id == 64 - n
+            assert session.get_device_for_instance(n).logical_instance == n
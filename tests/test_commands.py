@@ -10,6 +10,7 @@ from unittest.mock import Mock, MagicMock, patch, ANY
 import ace.commands
 from ace.protocol_ace2 import ACE2_COMMANDS_BY_NAME
 from ace.config import ACE_INSTANCES, INSTANCE_MANAGERS
+from ace.startup import AceStartupTimeline
 
 
 class TestCommandsModuleStructure:
@@ -2903,6 +2904,37 @@ class TestResetPersistentInventory:
 
 
 
+class TestStartupReportCommand:
+    """Tests for cmd_ACE_STARTUP_REPORT."""
+
+    def setup_method(self):
+        INSTANCE_MANAGERS.clear()
+        self.now = 50.0
+        self.manager = Mock()
+        self.manager.startup_timeline = AceStartupTimeline(lambda: self.now)
+        INSTANCE_MANAGERS[0] = self.manager
+        self.gcmd = Mock()
+
+    def teardown_method(self):
+        INSTANCE_MANAGERS.clear()
+
+    def test_reports_phase_table(self):
+        self.manager.startup_timeline.start([0])
+        self.now = 50.25
+        self.manager.startup_timeline.mark(0, "open")
+
+        ace.commands.cmd_ACE_STARTUP_REPORT(self.gcmd)
+
+        output = self.gcmd.respond_info.call_args[0][0]
+        assert "=== ACE Startup (seconds after klippy:ready) ===" in output
+        assert "ACE[0]" in output and "0.25" in output
+
+    def test_reports_when_not_started(self):
+        ace.commands.cmd_ACE_STARTUP_REPORT(self.gcmd)
+
+        assert "no startup recorded" in self.gcmd.respond_info.call_args[0][0]
+
+
 class TestConnectionStatusCommand:
     """Tests for cmd_ACE_GET_CONNECTION_STATUS."""
 
@@ -2958,6 +2990,255 @@ class TestConnectionStatusCommand:
         assert "Connected (stable)" in output
         assert "ACE[0]:" in output
 
+    def test_reader_stats_displayed(self):
+        """Test reader mode and wakeup counters are shown."""
+        self.mock_instance.serial_mgr.get_connection_status = Mock(return_value={
+            "connected": True,
+            "stable": True,
+            "time_connected": 120.0,
+            "recent_reconnects": 0,
+            "supervision": {},
+            "reader": {"mode": "fd", "wakeups": 42, "empty_wakeups": 1},
+        })
+
+        ace.commands.cmd_ACE_GET_CONNECTION_STATUS(self.mock_gcmd)
+
+        output = self.mock_gcmd.respond_info.call_args[0][0]
+        assert "Reader: fd - 42 wakeups, 1 empty" in output
+
+    def test_frame_cache_hit_rate_displayed(self):
+        """Test request frame cache counters are shown."""
+        self.mock_instance.serial_mgr.get_connection_status = Mock(return_value={
+            "connected": True,
+            "stable": True,
+            "time_connected": 120.0,
+            "recent_reconnects": 0,
+            "supervision": {},
+            "frame_cache": {"hits": 9, "misses": 1, "uncacheable": 0, "templates": 1},
+            "coalesced_requests": 4,
+        })
+
+        ace.commands.cmd_ACE_GET_CONNECTION_STATUS(self.mock_gcmd)
+
+        output = self.mock_gcmd.respond_info.call_args[0][0]
+        assert "Frame cache: 90% hit - 9 hits, 1 misses, 0 uncacheable" in output
+        assert "Coalesced reads: 4" in output
+
+    def test_queue_wait_stats_displayed(self):
+        """Test scheduler depth and wait times are shown."""
+        self.mock_instance.serial_mgr.get_connection_status = Mock(return_value={
+            "connected": True,
+            "stable": True,
+            "time_connected": 120.0,
+            "recent_reconnects": 0,
+            "supervision": {},
+            "queue": {
+                "depth": 1,
+                "peak_depth": 5,
+                "rejected": 0,
+                "high": {"avg_wait_s": 0.002, "max_wait_s": 0.040, "dropped_stale": 2},
+                "normal": {"avg_wait_s": 0.150, "max_wait_s": 1.200, "dropped_stale": 0},
+            },
+        })
+
+        ace.commands.cmd_ACE_GET_CONNECTION_STATUS(self.mock_gcmd)
+
+        output = self.mock_gcmd.respond_info.call_args[0][0]
+        assert ("Queue: 1 waiting (peak 5) - wait high 2/40ms, normal 150/1200ms avg/max, "
+                "2 stale dropped") in output
+
+    def test_bus_device_shares_displayed(self):
+        """Test per-device queue and window usage on a shared bus."""
+        self.mock_instance.serial_mgr.get_connection_status = Mock(return_value={
+            "connected": True,
+            "stable": True,
+            "time_connected": 120.0,
+            "recent_reconnects": 0,
+            "supervision": {},
+            "queue": {
+                "depth": 3,
+                "peak_depth": 6,
+                "high": {},
+                "normal": {},
+                "flows": {
+                    None: {"queued": 0, "dispatched": 2, "inflight": 0},
+                    2: {"queued": 0, "dispatched": 10, "inflight": 1},
+                    1: {"queued": 3, "dispatched": 40, "inflight": 2},
+                },
+            },
+        })
+
+        ace.commands.cmd_ACE_GET_CONNECTION_STATUS(self.mock_gcmd)
+
+        output = self.mock_gcmd.respond_info.call_args[0][0]
+        assert ("Bus devices: #1 3 queued/2 in flight/40 sent, "
+                "#2 0 queued/1 in flight/10 sent") in output
+
+    def test_bus_bringup_stats_displayed(self):
+        """Test the last ACE2 bus discovery/assignment timing is shown."""
+        self.mock_instance.serial_mgr.get_connection_status = Mock(return_value={
+            "connected": True,
+            "stable": True,
+            "time_connected": 120.0,
+            "recent_reconnects": 0,
+            "supervision": {},
+        })
+        self.mock_instance.bus_session = Mock(last_bringup={
+            "units_expected": 2,
+            "assigned": 2,
+            "discovery_rounds": 2,
+            "assign_rounds": 1,
+            "collisions": 1,
+            "retries": 1,
+            "timeouts": 0,
+            "discovery_s": 0.018,
+            "assignment_s": 0.006,
+            "total_s": 0.024,
+        })
+
+        ace.commands.cmd_ACE_GET_CONNECTION_STATUS(self.mock_gcmd)
+
+        output = self.mock_gcmd.respond_info.call_args[0][0]
+        assert ("Bus bring-up: 0 verified + 2 assigned of 2 in 24ms - verify 0ms, discovery 18ms/2 round(s), "
+                "assignment 6ms/1 round(s), 1 collisions, 1 retries, 0 timeouts") in output
+
+    def test_pacing_counters_displayed(self):
+        """Test wire pacing budget and counters are shown."""
+        self.mock_instance.serial_mgr.get_connection_status = Mock(return_value={
+            "connected": True,
+            "stable": True,
+            "time_connected": 120.0,
+            "recent_reconnects": 0,
+            "supervision": {},
+            "pacing": {
+                "enabled": True,
+                "burst_bytes": 1024,
+                "rate_bytes_s": 4096.0,
+                "frames_sent": 500,
+                "paced_frames": 3,
+                "max_delay_s": 0.012,
+            },
+        })
+
+        ace.commands.cmd_ACE_GET_CONNECTION_STATUS(self.mock_gcmd)
+
+        output = self.mock_gcmd.respond_info.call_args[0][0]
+        assert "Pacing: 1024B @ 4096B/s - 3 of 500 frames held (max 12ms)" in output
+
+    def test_transport_metrics_displayed(self):
+        """Test latency histograms, traffic and frame errors are shown."""
+        from ace.transport_metrics import AceTransportMetrics
+
+        metrics = AceTransportMetrics(window_size=4)
+        for _ in range(10):
+            metrics.record_rtt("get_status", 0.015)
+        metrics.record_timeout("get_status")
+        metrics.record_tx(30)
+        metrics.record_rx(120, frames=2)
+        metrics.record_notice("Invalid CRC")
+        self.mock_instance.serial_mgr.get_connection_status = Mock(return_value={
+            "connected": True,
+            "stable": True,
+            "time_connected": 120.0,
+            "recent_reconnects": 0,
+            "supervision": {},
+            "metrics": metrics.snapshot(),
+        })
+
+        ace.commands.cmd_ACE_GET_CONNECTION_STATUS(self.mock_gcmd)
+
+        output = self.mock_gcmd.respond_info.call_args[0][0]
+        assert ("Latency get_status: p50 20ms p95 20ms - avg 15.0ms, recent 15.0ms, max 15ms "
+                "(n=10, timeouts=1)") in output
+        assert "Traffic: tx 1 frames/30B, rx 2 frames/120B - window avg 0.00/4 (peak 0)" in output
+        assert "Frame errors: 1 CRC, 0 resync, 0 decode, 0 other" in output
+
+    def test_heartbeat_cadence_displayed(self):
+        """Test adaptive heartbeat mode, intervals and poll counts are shown."""
+        self.mock_instance.serial_mgr.get_connection_status = Mock(return_value={
+            "connected": True,
+            "stable": True,
+            "time_connected": 120.0,
+            "recent_reconnects": 0,
+            "supervision": {},
+            "heartbeat": {
+                "adaptive": True,
+                "mode": "idle",
+                "base_interval": 1.0,
+                "busy_interval": 0.15,
+                "idle_interval": 5.0,
+                "polls": {"busy": 40, "active": 300, "idle": 12},
+            },
+        })
+
+        ace.commands.cmd_ACE_GET_CONNECTION_STATUS(self.mock_gcmd)
+
+        output = self.mock_gcmd.respond_info.call_args[0][0]
+        assert "Heartbeat: idle - 0.15/1.0/5.0s busy/active/idle, polls 40/300/12" in output
+
+    def test_hotplug_reconnect_time_displayed(self):
+        """Test hot-plug state and last reconnect duration are shown."""
+        self.mock_instance.serial_mgr.get_connection_status = Mock(return_value={
+            "connected": True,
+            "stable": True,
+            "time_connected": 120.0,
+            "recent_reconnects": 1,
+            "supervision": {},
+            "hotplug": {
+                "enabled": True,
+                "events": 4,
+                "last_reconnect_s": 2.34,
+                "last_reconnect_trigger": "hotplug",
+            },
+        })
+
+        ace.commands.cmd_ACE_GET_CONNECTION_STATUS(self.mock_gcmd)
+
+        output = self.mock_gcmd.respond_info.call_args[0][0]
+        assert "Hot-plug: on - 4 device events, last reconnect 2.3s (hotplug)" in output
+
+    def test_port_inventory_displayed(self):
+        """Test shared port enumeration counters are shown."""
+        self.mock_instance.serial_mgr.get_connection_status = Mock(return_value={
+            "connected": True,
+            "stable": True,
+            "time_connected": 120.0,
+            "recent_reconnects": 0,
+            "supervision": {},
+            "port_inventory": {
+                "ports": 2,
+                "scans": 2,
+                "hits": 9,
+                "invalidations": 1,
+                "last_invalidation": "connect wave",
+            },
+        })
+
+        ace.commands.cmd_ACE_GET_CONNECTION_STATUS(self.mock_gcmd)
+
+        output = self.mock_gcmd.respond_info.call_args[0][0]
+        assert "Ports: 2 scans, 9 cached lookups, 1 invalidations (last: connect wave)" in output
+
+    def test_adaptive_timeouts_displayed(self):
+        """Test per-command adaptive timeouts are shown."""
+        self.mock_instance.serial_mgr.get_connection_status = Mock(return_value={
+            "connected": True,
+            "stable": True,
+            "time_connected": 120.0,
+            "recent_reconnects": 0,
+            "supervision": {},
+            "timeouts": {
+                "adaptive": True,
+                "default_s": 5.0,
+                "commands": {"get_status": {"timeout_s": 0.5, "srtt": 0.021, "samples": 12}},
+            },
+        })
+
+        ace.commands.cmd_ACE_GET_CONNECTION_STATUS(self.mock_gcmd)
+
+        output = self.mock_gcmd.respond_info.call_args[0][0]
+        assert "Timeouts: adaptive - get_status=0.50s (rtt 21ms, n=12)" in output
+
     def test_connected_stabilizing_status(self):
         """Test status display when connection is stabilizing."""
         self.mock_instance.serial_mgr.get_connection_status = Mock(return_value={
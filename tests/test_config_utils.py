@@ -13,6 +13,7 @@ from ace.config import (
     get_local_slot,
     normalize_ace_slot_state,
     parse_instance_baud_config,
+    _parse_auto_number,
     parse_instance_number,
     parse_instance_config,
     parse_instance_choice_config,
@@ -490,6 +491,47 @@ class TestParseInstanceBaudConfig:
         assert parse_instance_baud_config(config, 1, "ace2_proto") == 230400
 
 
+class TestParseAutoNumber:
+    """Test numeric options that default to a protocol value."""
+
+    def test_auto_returns_none(self):
+        assert _parse_auto_number("auto", "tx_rate_limit", float) is None
+        assert _parse_auto_number(" AUTO ", "tx_rate_limit", float) is None
+
+    def test_number_parsed_with_cast(self):
+        assert _parse_auto_number("2048", "tx_burst_bytes", int) == 2048
+        assert _parse_auto_number("0", "tx_rate_limit", float) == 0.0
+
+    def test_invalid_or_negative_falls_back_to_auto(self):
+        assert _parse_auto_number("fast", "tx_rate_limit", float) is None
+        assert _parse_auto_number("-5", "tx_burst_bytes", int) is None
+
+
+class TestSerialReaderModeConfig:
+    """serial_reader_mode validation in read_ace_config."""
+
+    @staticmethod
+    def _read(mode):
+        from unittest.mock import MagicMock
+        from ace.config import read_ace_config
+
+        config = MagicMock()
+        config.getint = MagicMock(return_value=1)
+        config.getfloat = MagicMock(return_value=1.0)
+        config.getboolean = MagicMock(return_value=True)
+        config.get = MagicMock(
+            side_effect=lambda key, default="": mode if key == "serial_reader_mode" else default
+        )
+        return read_ace_config(config)
+
+    def test_valid_mode_kept(self):
+        assert self._read(" Thread ")["serial_reader_mode"] == "thread"
+
+    def test_invalid_mode_warns_and_uses_fd(self, caplog):
+        assert self._read("threads")["serial_reader_mode"] == "fd"
+        assert "Invalid serial_reader_mode 'threads'" in caplog.text
+
+
 class TestGetAceInstanceAndSlot:
     """Test combined instance and slot lookup."""
     
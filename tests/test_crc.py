@@ -0,0 +1,52 @@
+"""Tests for the CRC-16/MCRF4XX implementations."""
+
+import random
+
+import pytest
+
+from ace.crc import (
+    CRC16_BACKEND,
+    crc16_mcrf4xx,
+    crc16_mcrf4xx_fast,
+    crc16_mcrf4xx_reference,
+    crc16_mcrf4xx_table,
+)
+
+
+IMPLEMENTATIONS = [crc16_mcrf4xx_table, crc16_mcrf4xx_fast, crc16_mcrf4xx]
+
+
+class TestCrc16Mcrf4xx:
+    """Every implementation must match the original shift loop bit-for-bit."""
+
+    @pytest.mark.parametrize("impl", IMPLEMENTATIONS)
+    def test_standard_check_value(self, impl):
+        assert impl(b"123456789") == 0x6F91
+
+    @pytest.mark.parametrize("impl", IMPLEMENTATIONS)
+    def test_empty_buffer_is_init_value(self, impl):
+        assert impl(b"") == 0xFFFF
+
+    @pytest.mark.parametrize("impl", IMPLEMENTATIONS)
+    def test_matches_reference_on_random_buffers(self, impl):
+        rng = random.Random(1234)
+        for length in list(range(0, 64)) + [255, 256, 1024, 4096]:
+            data = bytes(rng.getrandbits(8) for _ in range(length))
+            assert impl(data) == crc16_mcrf4xx_reference(data), length
+
+    @pytest.mark.parametrize("impl", IMPLEMENTATIONS)
+    def test_every_single_byte_value(self, impl):
+        for value in range(256):
+            assert impl(bytes([value])) == crc16_mcrf4xx_reference(bytes([value]))
+
+    @pytest.mark.parametrize("impl", IMPLEMENTATIONS)
+    def test_accepts_bytearray_and_memoryview(self, impl):
+        data = b'{"id":1,"method":"get_status"}'
+        expected = crc16_mcrf4xx_reference(data)
+
+        assert impl(bytearray(data)) == expected
+        assert impl(memoryview(bytearray(b"xx" + data))[2:]) == expected
+
+    def test_default_backend_is_c_accelerated(self):
+        assert CRC16_BACKEND == "binascii"
+        assert crc16_mcrf4xx is crc16_mcrf4xx_fast
@@ -0,0 +1,77 @@
+"""Tests for the adaptive heartbeat cadence."""
+
+from ace.heartbeat_policy import AceHeartbeatPolicy
+
+
+def _status(status="ready", action="none", dryer="stop"):
+    return {"status": status, "action": action, "dryer_status": {"status": dryer}}
+
+
+class TestAceHeartbeatPolicy:
+    """Busy / active / idle status poll intervals."""
+
+    def setup_method(self):
+        self.policy = AceHeartbeatPolicy(
+            base_interval=1.0, busy_interval=0.15, idle_interval=5.0, idle_after=60.0
+        )
+
+    def test_starts_at_base_interval(self):
+        assert self.policy.interval(0.0) == 1.0
+
+    def test_busy_device_polls_fast(self):
+        self.policy.note_status(_status(status="busy"), now=0.0)
+        assert self.policy.interval(0.0) == 0.15
+
+        self.policy.note_status(_status(action="feeding"), now=1.0)
+        assert self.policy.interval(1.0) == 0.15
+
+    def test_steady_busy_state_does_not_poll_fast(self):
+        # ACE2 reports busy for as long as feed assist runs
+        self.policy.note_status(_status(status="busy"), now=0.0, busy_is_idle=True)
+        assert self.policy.interval(0.0) == 1.0
+
+    def test_waiter_polls_fast_until_done(self):
+        self.policy.begin_wait(0.0)
+        assert self.policy.interval(0.0) == 0.15
+
+        self.policy.end_wait(0.5)
+        assert self.policy.interval(0.5) == 1.0
+
+    def test_idle_after_quiet_period(self):
+        self.policy.note_status(_status(), now=0.0)
+        assert self.policy.interval(59.0) == 1.0
+        assert self.policy.interval(61.0) == 5.0
+        assert self.policy.mode(61.0) == "idle"
+
+    def test_command_ends_idle_immediately(self):
+        self.policy.interval(0.0)
+        assert self.policy.mode(100.0) == "idle"
+
+        self.policy.note_command(100.0)
+
+        assert self.policy.mode(100.0) == "active"
+        assert self.policy.soonest_interval() == 0.15
+
+    def test_printing_and_dryer_keep_active_rate(self):
+        self.policy.interval(0.0)
+        self.policy.note_status(_status(), now=100.0, printing=True)
+        assert self.policy.interval(500.0) == 1.0
+
+        self.policy.note_status(_status(dryer="drying"), now=500.0)
+        assert self.policy.interval(900.0) == 1.0
+
+    def test_fixed_policy_ignores_activity(self):
+        policy = AceHeartbeatPolicy(base_interval=2.0, adaptive=False)
+        policy.begin_wait(0.0)
+
+        assert policy.interval(1000.0) == 2.0
+        assert policy.soonest_interval() == 2.0
+
+    def test_snapshot_counts_polls_per_mode(self):
+        self.policy.interval(0.0)
+        self.policy.begin_wait(1.0)
+        self.policy.interval(1.0)
+
+        snapshot = self.policy.snapshot(1.0)
+        assert snapshot["mode"] == "busy"
+        assert snapshot["polls"] == {"busy": 1, "active": 1, "idle": 0}
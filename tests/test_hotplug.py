@@ -0,0 +1,80 @@
+"""Tests for the inotify-based serial hot-plug watcher."""
+
+import os
+from unittest.mock import Mock
+
+import pytest
+
+from ace.hotplug import AceHotplugWatcher
+
+
+class TestAceHotplugWatcher:
+    """Device node events delivered through the reactor fd callback."""
+
+    def setup_method(self):
+        self.reactor = Mock()
+        self.reactor.register_fd.return_value = "fd-handle"
+        self.paths = []
+
+    def _start(self, watch_dirs):
+        watcher = AceHotplugWatcher(self.reactor, self.paths.append, watch_dirs)
+        if not watcher.start():
+            pytest.skip("inotify not available")
+        return watcher
+
+    def _fire(self):
+        _, callback = self.reactor.register_fd.call_args[0]
+        callback(0.0)
+
+    def test_reports_new_entries_matching_prefix(self, tmp_path):
+        watcher = self._start([(str(tmp_path), "tty")])
+        try:
+            (tmp_path / "ttyACM0").write_text("")
+            (tmp_path / "null").write_text("")
+            self._fire()
+        finally:
+            watcher.stop()
+
+        assert self.paths == [os.path.join(str(tmp_path), "ttyACM0")]
+        assert watcher.events == 1
+
+    def test_reports_renamed_symlinks(self, tmp_path):
+        by_path = tmp_path / "by-path"
+        by_path.mkdir()
+        watcher = self._start([(str(by_path), "")])
+        try:
+            tmp_link = tmp_path / "tmp-link"
+            tmp_link.symlink_to("/dev/null")
+            os.rename(tmp_link, by_path / "platform-usb-0:1.2:1.0")
+            self._fire()
+        finally:
+            watcher.stop()
+
+        assert self.paths == [str(by_path / "platform-usb-0:1.2:1.0")]
+
+    def test_no_existing_directory_fails_start(self, tmp_path):
+        watcher = AceHotplugWatcher(self.reactor, self.paths.append, [(str(tmp_path / "missing"), "")])
+
+        assert watcher.start() is False
+        assert not watcher.active
+        self.reactor.register_fd.assert_not_called()
+
+    def test_stop_unregisters_fd(self, tmp_path):
+        watcher = self._start([(str(tmp_path), "")])
+
+        watcher.stop()
+
+        self.reactor.unregister_fd.assert_called_once_with("fd-handle")
+        assert not watcher.active
+
+    def test_callback_errors_do_not_propagate(self, tmp_path):
+        watcher = AceHotplugWatcher(self.reactor, Mock(side_effect=RuntimeError("boom")), [(str(tmp_path), "")])
+        if not watcher.start():
+            pytest.skip("inotify not available")
+        try:
+            (tmp_path / "ttyUSB0").write_text("")
+            self._fire()
+        finally:
+            watcher.stop()
+
+        assert watcher.events == 1
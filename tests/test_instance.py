@@ -30,6 +30,7 @@ from ace.config import (
     RFID_STATE_NO_INFO,
     RFID_STATE_IDENTIFIED,
     create_inventory,
+    normalize_ace_slot_state,
 )
 
 
@@ -164,6 +165,21 @@ class TestAceInstance(unittest.TestCase):
         self.assertEqual(status.get('protocol'), 'ace2_proto')
         self.assertEqual(status.get('model'), 'ACE2 (USB Single Serial)')
 
+    @patch('ace.instance.AceSerialManager')
+    def test_get_status_includes_transport_summary(self, mock_serial_mgr_class):
+        """Link health figures are exposed for Moonraker/KlipperScreen."""
+        from ace.transport_metrics import AceTransportMetrics
+
+        instance = AceInstance(0, self.ace_config, self.mock_printer)
+        instance.serial_mgr.metrics = AceTransportMetrics(window_size=4)
+        instance.serial_mgr.metrics.record_rtt("get_status", 0.02)
+        instance.serial_mgr.metrics.record_notice("Invalid CRC")
+
+        transport = instance.get_status()["transport"]
+
+        self.assertEqual(transport["rtt_avg_ms"], 20.0)
+        self.assertEqual(transport["crc_errors"], 1)
+
     @patch('ace.instance.AceSerialManager')
     def test_get_status_maps_ace2_version_fields_to_firmware(self, mock_serial_mgr_class):
         """ACE2 version keys should map to dashboard firmware fields."""
@@ -270,10 +286,34 @@ class TestAceInstance(unittest.TestCase):
         instance.serial_mgr.send_high_prio_request.assert_called_once_with(
             {'command': 'GET_STATUS', 'params': {}, 'target_device_id': 7},
             instance._on_heartbeat_response,
+            max_wait=instance.heartbeat_policy.base_interval,
         )
         self.mock_reactor.register_timer.assert_called_once()
         self.assertEqual(instance._shared_bus_heartbeat_timer, 'heartbeat-timer')
 
+    @patch('ace.instance.AceSerialManager')
+    def test_shared_bus_heartbeat_follows_policy(self, mock_serial_mgr_class):
+        """Shared-bus polling uses the instance's adaptive heartbeat policy."""
+        ace_config = dict(self.ace_config)
+        ace_config['protocol'] = 'ace2_proto'
+        ace_config['heartbeat_busy_interval'] = 0.2
+        self.mock_reactor.register_timer = Mock(return_value='heartbeat-timer')
+        self.mock_reactor.monotonic = Mock(return_value=10.0)
+        bus_session = Ace2BusSession(port='/dev/ttyUSB0')
+        bus_session.bind_logical_instance(0, 11, 22, 33)
+        bus_session.assign_device_id(11, 22, 33, 7)
+        instance = AceInstance(0, ace_config, self.mock_printer, bus_session=bus_session)
+        instance.serial_mgr.is_connected.return_value = True
+        instance.start_shared_bus_heartbeat()
+
+        self.assertEqual(instance._shared_bus_heartbeat_tick(10.0), 10.0 + instance.heartbeat_interval)
+
+        # A command pulls the pending poll forward and polls stay fast while busy
+        instance.send_request({'command': 'GET_INFO', 'params': {}}, Mock())
+        self.mock_reactor.update_timer.assert_called_once_with('heartbeat-timer', 10.2)
+        instance.heartbeat_policy.note_status({'status': 'busy'}, 10.0)
+        self.assertAlmostEqual(instance._shared_bus_heartbeat_tick(10.2), 10.4)
+
     @patch('ace.instance.AceSerialManager')
     def test_request_shared_bus_info_refresh_uses_targeted_get_info(self, mock_serial_mgr_class):
         """Shared-bus info refresh should use targeted get_info after assignment."""
@@ -1498,6 +1538,26 @@ class TestStatusCallbacks(unittest.TestCase):
             return self.mock_save_vars
         return default
 
+    @patch('ace.instance.AceSerialManager')
+    def test_startup_phases_reported_to_manager(self, mock_serial_mgr_class):
+        """First status and completed RFID refresh are reported as startup phases."""
+        INSTANCE_MANAGERS.clear()
+        instance = AceInstance(0, self.ace_config, self.mock_printer)
+        INSTANCE_MANAGERS[0] = Mock()
+        instance._pending_rfid_refresh = True
+
+        instance._on_heartbeat_response({'code': 0, 'result': {'slots': []}})
+
+        INSTANCE_MANAGERS[0].note_startup_phase.assert_any_call(0, "status")
+        self.assertNotIn(
+            call(0, "rfid"), INSTANCE_MANAGERS[0].note_startup_phase.call_args_list
+        )
+
+        for slot_idx in list(instance._pending_rfid_queries):
+            instance._handle_rfid_info_response(slot_idx, None)
+
+        INSTANCE_MANAGERS[0].note_startup_phase.assert_called_with(0, "rfid")
+
     @patch('ace.instance.AceSerialManager')
     def test_status_update_rfid_sync_enabled_updates_inventory(self, mock_serial_mgr_class):
         """RFID data populates material with gray placeholder color (actual color from callback)."""
@@ -1786,6 +1846,97 @@ class TestStatusCallbacks(unittest.TestCase):
         self.assertEqual(instance._info['status'], 'ready')
         self.assertEqual(instance._info['temp'], 25)
 
+    @patch('ace.instance.AceSerialManager')
+    def test_unchanged_heartbeat_skips_slot_reconciliation(self, mock_serial_mgr_class):
+        """Identical heartbeats reconcile only slots whose payload or inventory moved."""
+        instance = AceInstance(0, self.ace_config, self.mock_printer)
+
+        def heartbeat(slot2_status='empty'):
+            return {
+                'code': 0,
+                'result': {
+                    'status': 'ready',
+                    'slots': [
+                        {'index': 0, 'status': 'empty'},
+                        {'index': 1, 'status': 'ready', 'rfid': 0},
+                        {'index': 2, 'status': slot2_status, 'rfid': 0},
+                        {'index': 3, 'status': 'empty'},
+                    ]
+                }
+            }
+
+        with patch('ace.instance.normalize_ace_slot_state', wraps=normalize_ace_slot_state) as normalize:
+            instance._on_heartbeat_response(heartbeat())
+            self.assertEqual(normalize.call_count, 4)
+            self.assertEqual(instance.inventory[1]['material'], instance.DEFAULT_MATERIAL)
+
+            normalize.reset_mock()
+            instance._on_heartbeat_response(heartbeat())
+            self.assertEqual(normalize.call_count, 0)
+
+            normalize.reset_mock()
+            instance._on_heartbeat_response(heartbeat(slot2_status='ready'))
+            self.assertEqual(normalize.call_count, 1)
+            self.assertEqual(instance.inventory[2]['status'], 'ready')
+
+            # A local inventory edit makes the slot dirty again
+            normalize.reset_mock()
+            instance.inventory[1]['material'] = ''
+            instance._on_heartbeat_response(heartbeat(slot2_status='ready'))
+            self.assertEqual(normalize.call_count, 1)
+            self.assertEqual(instance.inventory[1]['material'], instance.DEFAULT_MATERIAL)
+
+    @patch('ace.instance.AceSerialManager')
+    def test_unchanged_ace2_heartbeat_leaves_slots_undecoded(self, mock_serial_mgr_class):
+        """An idle ACE2 heartbeat never materialises its lazily decoded slot array."""
+        from ace.protocol_ace2 import AceProtoProtocolAdapter
+
+        instance = AceInstance(0, self.ace_config, self.mock_printer)
+        adapter = AceProtoProtocolAdapter()
+        payload = b"\x08\x01" + b"\x4a\x04\x08\x00\x10\x00" * 4
+
+        instance._on_heartbeat_response(adapter._decode_response_payload("GET_STATUS", payload))
+        response = adapter._decode_response_payload("GET_STATUS", payload)
+        instance._on_heartbeat_response(response)
+
+        self.assertIn("slots", response["result"]._pending)
+        self.assertEqual(instance._info["status"], "ready")
+        self.assertEqual(instance.get_status()["slots"][3]["status"], "empty")
+
+    @patch('ace.instance.AceSerialManager')
+    def test_reconnect_reconciles_every_slot(self, mock_serial_mgr_class):
+        """The first heartbeat after a reconnect is never short-circuited."""
+        instance = AceInstance(0, self.ace_config, self.mock_printer)
+        response = {
+            'code': 0,
+            'result': {'status': 'ready', 'slots': [{'index': i, 'status': 'empty'} for i in range(4)]},
+        }
+        instance._on_heartbeat_response(response)
+
+        instance._on_ace_connect()
+        with patch('ace.instance.normalize_ace_slot_state', wraps=normalize_ace_slot_state) as normalize:
+            instance._on_heartbeat_response(response)
+
+        self.assertEqual(normalize.call_count, 4)
+
+    @patch('ace.instance.AceSerialManager')
+    def test_wait_ready_polls_at_busy_cadence(self, mock_serial_mgr_class):
+        """wait_ready registers as a waiter and pulls the next poll forward."""
+        instance = AceInstance(0, self.ace_config, self.mock_printer)
+        instance._info['status'] = 'busy'
+        waiters = []
+
+        def become_ready(_until):
+            waiters.append(instance.heartbeat_policy.waiters)
+            instance._info['status'] = 'ready'
+
+        self.mock_reactor.pause = Mock(side_effect=become_ready)
+        instance.wait_ready()
+
+        self.assertEqual(waiters, [1])
+        self.assertEqual(instance.heartbeat_policy.waiters, 0)
+        instance.serial_mgr.heartbeat_soon.assert_called_once_with()
+
     @patch('ace.instance.AceSerialManager')
     def test_heartbeat_failures_trigger_reconnect_after_threshold(self, mock_serial_mgr_class):
         """Repeated heartbeat failures should trigger reconnect once threshold is hit."""
@@ -2229,6 +2380,152 @@ class TestStatusCallbacks(unittest.TestCase):
         # The test would need to mock the callback to verify this behavior.
 
 
+class TestStatusSnapshot(unittest.TestCase):
+    """Warm start from a persisted status snapshot."""
+
+    def setUp(self):
+        INSTANCE_MANAGERS.clear()
+        self.mock_printer = Mock()
+        self.mock_reactor = Mock()
+        self.mock_reactor.monotonic.return_value = 0.0
+        self.mock_gcode = Mock()
+        self.mock_printer.get_reactor.return_value = self.mock_reactor
+        self.mock_printer.lookup_object.side_effect = (
+            lambda name, default=None: self.mock_gcode if name == 'gcode' else default
+        )
+        self.ace_config = {
+            'baud': 115200,
+            'timeout_multiplier': 2.0,
+            'filament_runout_sensor_name_rdm': 'return_module',
+            'filament_runout_sensor_name_nozzle': 'toolhead_sensor',
+            'feed_speed': 100,
+            'retract_speed': 100,
+            'total_max_feeding_length': 1000,
+            'parkposition_to_toolhead_length': 500,
+            'toolchange_load_length': 480,
+            'parkposition_to_rdm_length': 350,
+            'incremental_feeding_length': 10,
+            'incremental_feeding_speed': 50,
+            'extruder_feeding_length': 50,
+            'extruder_feeding_speed': 5,
+            'toolhead_slow_loading_speed': 10,
+            'heartbeat_interval': 1.0,
+            'max_dryer_temperature': 70,
+            'toolhead_full_purge_length': 100,
+            'rfid_inventory_sync_enabled': True,
+        }
+
+    def tearDown(self):
+        INSTANCE_MANAGERS.clear()
+
+    def _live_status(self, slot1_sku='SKU-B'):
+        return {
+            'code': 0,
+            'result': {
+                'status': 'ready',
+                'temp': 25,
+                'raw_fields': {'x': 1},
+                'slots': [
+                    {'index': 0, 'status': 'ready', 'rfid': 2, 'sku': 'SKU-A', 'type': 'PLA',
+                     'color': [1, 2, 3], 'icon_type': 0},
+                    {'index': 1, 'status': 'ready', 'rfid': 2, 'sku': slot1_sku, 'type': 'PETG',
+                     'color': [4, 5, 6]},
+                    {'index': 2, 'status': 'empty', 'rfid': 0, 'sku': '', 'type': '', 'color': [0, 0, 0]},
+                    {'index': 3, 'status': 'empty', 'rfid': 0, 'sku': '', 'type': '', 'color': [0, 0, 0]},
+                ],
+            },
+        }
+
+    def _make_instance(self):
+        with patch('ace.instance.AceSerialManager') as mock_serial_mgr_class:
+            mock_serial_mgr_class.return_value.device_info = {}
+            instance = AceInstance(0, self.ace_config, self.mock_printer)
+        INSTANCE_MANAGERS[0] = Mock()
+        return instance
+
+    def _saved_snapshot(self):
+        instance = self._make_instance()
+        instance.serial_mgr.device_info = {'model': 'ACE Pro', 'firmware': 'V1.3.84', 'id': 7}
+        instance._status_update_callback(self._live_status())
+        return instance.build_status_snapshot()
+
+    def test_no_snapshot_before_live_status(self):
+        instance = self._make_instance()
+
+        self.assertIsNone(instance.build_status_snapshot())
+
+    def test_snapshot_is_compact(self):
+        snapshot = self._saved_snapshot()
+
+        self.assertEqual(snapshot['version'], AceInstance.STATUS_SNAPSHOT_VERSION)
+        self.assertNotIn('raw_fields', snapshot['status'])
+        self.assertNotIn('icon_type', snapshot['status']['slots'][0])
+        self.assertEqual(snapshot['device_info'], {'model': 'ACE Pro', 'firmware': 'V1.3.84'})
+
+    def test_restored_status_is_stale_until_live(self):
+        snapshot = self._saved_snapshot()
+        instance = self._make_instance()
+
+        self.assertTrue(instance.restore_status_snapshot(snapshot))
+        status = instance.get_status()
+        self.assertTrue(status['stale'])
+        self.assertIn('snapshot_age_s', status)
+        self.assertEqual(status['firmware'], 'V1.3.84')
+        self.assertFalse(instance._is_slot_empty(0))
+        # A stale snapshot is never re-saved as if it were live
+        self.assertIsNone(instance.build_status_snapshot())
+
+        instance._on_heartbeat_response(self._live_status())
+
+        self.assertFalse(instance.get_status()['stale'])
+
+    def test_warm_start_still_refreshes_every_slot(self):
+        snapshot = self._saved_snapshot()
+        instance = self._make_instance()
+        instance.restore_status_snapshot(snapshot)
+        instance._pending_rfid_refresh = True  # set by _on_ace_connect
+        instance._query_rfid_full_data = Mock()
+
+        # Same SKU and colour as the snapshot: a swapped spool looks unchanged
+        instance._status_update_callback(self._live_status())
+
+        queried = sorted({c.args[0] for c in instance._query_rfid_full_data.call_args_list})
+        self.assertEqual(queried, [0, 1, 2, 3])
+
+    def test_snapshot_never_reports_unit_ready_before_live_status(self):
+        snapshot = self._saved_snapshot()
+        self.assertEqual(snapshot['status']['status'], 'ready')
+        instance = self._make_instance()
+        instance.restore_status_snapshot(snapshot)
+        instance._heartbeat_soon = Mock()
+
+        self.assertFalse(instance.is_ready())
+        self.assertNotEqual(instance.get_status()['status'], 'ready')
+        with self.assertRaises(TimeoutError):
+            instance.wait_ready(timeout_s=1.0)
+
+        instance._status_update_callback(self._live_status())
+
+        self.assertTrue(instance.is_ready())
+        instance.wait_ready(timeout_s=1.0)
+
+    def test_cold_start_refreshes_every_slot(self):
+        instance = self._make_instance()
+        instance._pending_rfid_refresh = True
+        instance._query_rfid_full_data = Mock()
+
+        instance._status_update_callback(self._live_status())
+
+        queried = sorted({c.args[0] for c in instance._query_rfid_full_data.call_args_list})
+        self.assertEqual(queried, [0, 1, 2, 3])
+
+    def test_rejects_unknown_snapshot_version(self):
+        instance = self._make_instance()
+
+        self.assertFalse(instance.restore_status_snapshot({'version': 99, 'status': {'slots': []}}))
+        self.assertFalse(instance.get_status()['stale'])
+
+
 class TestFeedRetractOperations(unittest.TestCase):
     """Test feed and retract operations."""
 
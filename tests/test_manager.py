@@ -14,6 +14,7 @@ import unittest
 from unittest.mock import Mock, patch, PropertyMock, call
 import time
 
+from ace.ace2_bus import Ace2BusBringUp
 from ace.manager import AceManager, toolchange_in_progress_guard
 from ace.config import (
     ACE_INSTANCES,
@@ -351,6 +352,7 @@ class TestHandleReady(unittest.TestCase):
         inst.serial_mgr = kwargs.get("serial_mgr", Mock(connect_to_ace=Mock(), disconnect=Mock()))
         inst.filament_runout_sensor_name_nozzle = "toolhead_sensor"
         inst.filament_runout_sensor_name_rdm = "return_module"
+        inst.port_inventory = kwargs.get("port_inventory")
         return inst
 
     def _build_manager(self):
@@ -382,6 +384,93 @@ class TestHandleReady(unittest.TestCase):
 
         manager.instances[0].serial_mgr.connect_to_ace.assert_called_once_with(230400, 2)
 
+    def test_instances_share_one_port_inventory(self):
+        manager = self._build_manager()
+
+        self.assertIsNotNone(manager.port_inventory)
+        self.assertIs(manager.instances[0].port_inventory, manager.port_inventory)
+
+    def test_connect_wave_invalidates_cached_ports(self):
+        manager = self._build_manager()
+        manager._setup_sensors = Mock()
+        manager._start_monitoring = Mock()
+        manager.port_inventory = Mock()
+
+        manager._handle_ready()
+
+        manager.port_inventory.invalidate.assert_called_once_with("connect wave")
+
+    def test_startup_connect_time_reported_once(self):
+        manager = self._build_manager()
+        manager._setup_sensors = Mock()
+        manager._start_monitoring = Mock()
+        self.mock_reactor.monotonic.return_value = 10.0
+
+        manager._handle_ready()
+        on_connect = manager.instances[0].serial_mgr.set_on_connect_callback.call_args[0][0]
+        self.mock_reactor.monotonic.return_value = 11.5
+        on_connect()
+        on_connect()  # later reconnects are not startup
+
+        messages = [c[0][0] for c in self.mock_gcode.respond_info.call_args_list]
+        matches = [m for m in messages if "after klippy:ready" in m]
+        self.assertEqual(matches, [
+            "ACE: All 1 connection(s) up 1.50s after klippy:ready "
+            "(ACE_STARTUP_REPORT for phase timings)"
+        ])
+
+    def test_status_snapshot_restored_at_init(self):
+        snapshot = {"version": 1, "status": {"slots": []}, "device_info": {}}
+        self.variables["ace_status_snapshot_0"] = snapshot
+
+        manager = self._build_manager()
+
+        manager.instances[0].restore_status_snapshot.assert_called_once_with(snapshot)
+
+    def test_status_snapshot_saved_on_disconnect(self):
+        manager = self._build_manager()
+        manager._stop_monitoring = Mock()
+        manager._restore_sensors = Mock()
+        snapshot = {"version": 1, "status": {"slots": []}, "device_info": {}}
+        manager.instances[0].build_status_snapshot = Mock(return_value=snapshot)
+
+        manager._handle_disconnect()
+
+        self.assertEqual(self.variables["ace_status_snapshot_0"], snapshot)
+        self.assertFalse(manager.state.has_pending)
+
+    def test_state_flushed_when_snapshot_save_fails(self):
+        manager = self._build_manager()
+        manager._stop_monitoring = Mock()
+        manager._restore_sensors = Mock()
+        manager._save_status_snapshots = Mock(side_effect=RuntimeError("boom"))
+        manager.state.flush = Mock()
+
+        manager._handle_disconnect()
+
+        manager.state.flush.assert_called_once()
+
+    def test_disconnect_shuts_transports_down(self):
+        manager = self._build_manager()
+        manager._stop_monitoring = Mock()
+        manager._restore_sensors = Mock()
+
+        manager._handle_disconnect()
+
+        manager.instances[0].serial_mgr.shutdown.assert_called_once()
+
+    def test_unreachable_unit_keeps_previous_snapshot(self):
+        previous = {"version": 1, "status": {"slots": []}, "device_info": {}}
+        self.variables["ace_status_snapshot_0"] = previous
+        manager = self._build_manager()
+        manager._stop_monitoring = Mock()
+        manager._restore_sensors = Mock()
+        manager.instances[0].build_status_snapshot = Mock(return_value=None)
+
+        manager._handle_disconnect()
+
+        self.assertIs(self.variables["ace_status_snapshot_0"], previous)
+
     def test_disabled_path_skips_connections(self):
         self.variables["ace_global_enabled"] = False
         manager = self._build_manager()
@@ -617,27 +706,305 @@ class TestSharedAce2Transport(unittest.TestCase):
         shared_serial_mgr.send_high_prio_request.side_effect = (
             lambda request, callback: callback(None)
         )
+        on_done = Mock()
 
-        ready_count = manager._initialize_shared_bus_transport(manager.instances[0])
+        manager._initialize_shared_bus_transport(manager.instances[0], on_done=on_done)
 
         self.mock_gcode.respond_info.assert_any_call(
             "ACE[0]: ACE2 discovery returned no devices on shared bus"
         )
-        self.assertEqual(ready_count, 0)
+        on_done.assert_called_once_with(0)
+        # An empty bus is rescanned for the full expected count each round
+        self.assertEqual(
+            shared_serial_mgr.send_high_prio_request.call_count,
+            2 * Ace2BusBringUp.MAX_DISCOVERY_ROUNDS,
+        )
 
-    def test_send_shared_bus_request_times_out_when_callback_never_fires(self):
+    def test_initialize_shared_bus_transport_does_not_block_the_reactor(self):
         manager = self._build_manager()
         shared_serial_mgr = manager.instances[0].serial_mgr
-        shared_serial_mgr.send_high_prio_request.side_effect = lambda request, callback: None
+        pending = []
+        shared_serial_mgr.send_high_prio_request.side_effect = (
+            lambda request, callback: pending.append((request, callback))
+        )
+        on_done = Mock()
 
-        response = manager._send_shared_bus_request(
-            manager.instances[0],
-            {"command": "DISCOVER_DEVICE", "params": {}},
-            timeout_s=0.01,
+        bringup = manager._initialize_shared_bus_transport(manager.instances[0], on_done=on_done)
+
+        # Both discovers are on the wire before either is answered
+        self.assertEqual([request["command"] for request, _ in pending], ["DISCOVER_DEVICE"] * 2)
+        self.mock_reactor.pause.assert_not_called()
+        on_done.assert_not_called()
+
+        for (request, callback), uid in zip(list(pending), [(11, 22, 33), (44, 55, 66)]):
+            callback({"result": {"uid1": uid[0], "uid2": uid[1], "uid3": uid[2]}})
+        self.assertEqual([request["command"] for request, _ in pending[2:]], ["ASSIGN_DEVICE_ID"] * 2)
+        for request, callback in list(pending[2:]):
+            callback({"code": 0, "msg": "SUCCESS"})
+
+        on_done.assert_called_once_with(2)
+        self.assertTrue(bringup.done)
+        self.assertEqual(bringup.stats["discovery_rounds"], 1)
+        self.assertEqual(bringup.stats["assign_rounds"], 1)
+        self.assertEqual(manager.instances[0].bus_session.last_bringup["assigned"], 2)
+
+    def test_initialize_shared_bus_transport_retries_collided_discovery(self):
+        manager = self._build_manager()
+        shared_serial_mgr = manager.instances[0].serial_mgr
+        responses = iter([
+            {"result": {"uid1": 11, "uid2": 22, "uid3": 33}},
+            {"result": {"uid1": 0, "uid2": 0, "uid3": 0}},  # garbled by a collision
+            {"result": {"uid1": 44, "uid2": 55, "uid3": 66}},
+            {"code": 0, "msg": "SUCCESS"},
+            {"code": 0, "msg": "SUCCESS"},
+        ])
+        shared_serial_mgr.send_high_prio_request.side_effect = (
+            lambda request, callback: callback(next(responses))
+        )
+        on_done = Mock()
+
+        bringup = manager._initialize_shared_bus_transport(manager.instances[0], on_done=on_done)
+
+        commands = [
+            call_args[0][0]["command"]
+            for call_args in shared_serial_mgr.send_high_prio_request.call_args_list
+        ]
+        self.assertEqual(commands, ["DISCOVER_DEVICE"] * 3 + ["ASSIGN_DEVICE_ID"] * 2)
+        on_done.assert_called_once_with(2)
+        self.assertEqual(bringup.stats["collisions"], 1)
+        self.assertEqual(bringup.stats["discovery_rounds"], 2)
+        self.assertEqual(bringup.stats["retries"], 1)
+
+    def test_initialize_shared_bus_transport_retries_failed_assignment(self):
+        manager = self._build_manager()
+        shared_serial_mgr = manager.instances[0].serial_mgr
+        responses = iter([
+            {"result": {"uid1": 11, "uid2": 22, "uid3": 33}},
+            {"result": {"uid1": 44, "uid2": 55, "uid3": 66}},
+            {"code": 0, "msg": "SUCCESS"},
+            None,
+            {"code": 0, "msg": "SUCCESS"},
+        ])
+        shared_serial_mgr.send_high_prio_request.side_effect = (
+            lambda request, callback: callback(next(responses))
+        )
+        on_done = Mock()
+
+        bringup = manager._initialize_shared_bus_transport(manager.instances[0], on_done=on_done)
+
+        requests = [call_args[0][0] for call_args in shared_serial_mgr.send_high_prio_request.call_args_list]
+        self.assertEqual(requests[-1]["params"], {"uid1": 44, "uid2": 55, "uid3": 66, "device_id": 2})
+        on_done.assert_called_once_with(2)
+        self.assertEqual(bringup.stats["assign_rounds"], 2)
+        self.assertEqual(bringup.failed_assignments, [])
+        messages = [call_args[0][0] for call_args in self.mock_gcode.respond_info.call_args_list]
+        self.assertTrue(any(msg.startswith("ACE[0]: ACE2 bus up: 2/2 devices") for msg in messages))
+        self.assertFalse(any("assignment failed" in msg for msg in messages))
+
+    def test_shared_bus_bringup_records_info_phase_for_every_bound_unit(self):
+        manager = self._build_manager()
+        manager.startup_timeline.start([0, 1])
+        shared_serial_mgr = manager.instances[0].serial_mgr
+        responses = iter([
+            {"result": {"uid1": 11, "uid2": 22, "uid3": 33}},
+            {"result": {"uid1": 44, "uid2": 55, "uid3": 66}},
+            {"code": 0, "msg": "SUCCESS"},
+            {"code": 0, "msg": "SUCCESS"},
+        ])
+        shared_serial_mgr.send_high_prio_request.side_effect = (
+            lambda request, callback: callback(next(responses, None))
+        )
+
+        manager._initialize_shared_bus_transport(manager.instances[0])
+
+        self.assertIsNotNone(manager.startup_timeline.elapsed(0, "info"))
+        self.assertIsNotNone(manager.startup_timeline.elapsed(1, "info"))
+
+    def test_initialize_shared_bus_transport_reports_assignment_that_never_succeeds(self):
+        manager = self._build_manager()
+        shared_serial_mgr = manager.instances[0].serial_mgr
+        responses = iter([
+            {"result": {"uid1": 11, "uid2": 22, "uid3": 33}},
+            {"result": {"uid1": 44, "uid2": 55, "uid3": 66}},
+        ])
+
+        def send_high_prio_request(request, callback):
+            if request["command"] == "DISCOVER_DEVICE":
+                callback(next(responses))
+            else:
+                callback({"code": 0 if request["params"]["device_id"] == 1 else 1, "msg": "x"})
+
+        shared_serial_mgr.send_high_prio_request.side_effect = send_high_prio_request
+        on_done = Mock()
+
+        bringup = manager._initialize_shared_bus_transport(manager.instances[0], on_done=on_done)
+
+        self.assertEqual(bringup.stats["assign_rounds"], Ace2BusBringUp.MAX_ASSIGN_ROUNDS)
+        self.assertEqual([d.identity.uid_tuple for d in bringup.failed_assignments], [(44, 55, 66)])
+        self.mock_gcode.respond_info.assert_any_call(
+            "ACE[0]: ACE2 device-id assignment failed for UID=(44, 55, 66): {'code': 1, 'msg': 'x'}"
         )
+        on_done.assert_called_once_with(1)
+
+    def test_initialize_shared_bus_transport_persists_assigned_device_ids(self):
+        manager = self._build_manager()
+        shared_serial_mgr = manager.instances[0].serial_mgr
+        responses = iter([
+            {"result": {"uid1": 11, "uid2": 22, "uid3": 33}},
+            {"result": {"uid1": 44, "uid2": 55, "uid3": 66}},
+            {"code": 0, "msg": "SUCCESS"},
+            {"code": 0, "msg": "SUCCESS"},
+        ])
+        shared_serial_mgr.send_high_prio_request.side_effect = (
+            lambda request, callback: callback(next(responses))
+        )
+
+        manager._initialize_shared_bus_transport(manager.instances[0])
 
-        assert response is None
-        assert self.mock_reactor.pause.called
+        assert self.variables["ace2_bus_device_ids_0_1"] == {0: 1, 1: 2}
+
+    def _persist_previous_bus(self):
+        self.variables["ace2_bus_bindings_0_1"] = {"0": [11, 22, 33], "1": [44, 55, 66]}
+        self.variables["ace2_bus_device_ids_0_1"] = {"0": 1, "1": 2}
+
+    def test_reconnect_verifies_persisted_device_ids_without_rediscovery(self):
+        self._persist_previous_bus()
+        manager = self._build_manager()
+        shared_serial_mgr = manager.instances[0].serial_mgr
+
+        def send_high_prio_request(request, callback):
+            callback({
+                "command": "GET_INFO",
+                "device_id": request["target_device_id"],
+                "code": 0,
+                "result": {"version": "V2", "first_request": False},
+            })
+
+        shared_serial_mgr.send_high_prio_request.side_effect = send_high_prio_request
+        on_done = Mock()
+
+        bringup = manager._initialize_shared_bus_transport(manager.instances[0], on_done=on_done)
+
+        requests = [call_args[0][0] for call_args in shared_serial_mgr.send_high_prio_request.call_args_list]
+        assert requests == [
+            {"command": "GET_INFO", "params": {}, "target_device_id": 1},
+            {"command": "GET_INFO", "params": {}, "target_device_id": 2},
+        ]
+        on_done.assert_called_once_with(2)
+        self.assertEqual(bringup.stats["verified"], 2)
+        self.assertEqual(bringup.stats["discovery_rounds"], 0)
+        bus_session = manager.instances[0].bus_session
+        self.assertEqual(bus_session.get_device_for_instance(1).device_id, 2)
+        messages = [call_args[0][0] for call_args in self.mock_gcode.respond_info.call_args_list]
+        self.assertIn("ACE[0]: ACE2 bus up: 2/2 devices in 0ms (2 persisted device id(s) verified)", messages)
+
+    def test_reconnect_rediscovers_and_reassigns_only_unverified_units(self):
+        self._persist_previous_bus()
+        manager = self._build_manager()
+        shared_serial_mgr = manager.instances[0].serial_mgr
+        discovers = iter([
+            {"result": {"uid1": 11, "uid2": 22, "uid3": 33}},
+            {"result": {"uid1": 44, "uid2": 55, "uid3": 66}},
+        ])
+
+        def send_high_prio_request(request, callback):
+            command = request["command"]
+            if command == "GET_INFO":
+                # Unit 2 was power cycled and no longer answers on its old id
+                if request["target_device_id"] == 1:
+                    callback({"device_id": 1, "code": 0, "result": {"first_request": False}})
+                else:
+                    callback(None)
+            elif command == "DISCOVER_DEVICE":
+                callback(next(discovers))
+            else:
+                callback({"code": 0, "msg": "SUCCESS"})
+
+        shared_serial_mgr.send_high_prio_request.side_effect = send_high_prio_request
+        on_done = Mock()
+
+        bringup = manager._initialize_shared_bus_transport(manager.instances[0], on_done=on_done)
+
+        requests = [call_args[0][0] for call_args in shared_serial_mgr.send_high_prio_request.call_args_list]
+        assert [request["command"] for request in requests] == [
+            "GET_INFO", "GET_INFO", "DISCOVER_DEVICE", "DISCOVER_DEVICE", "ASSIGN_DEVICE_ID",
+        ]
+        assert requests[-1]["params"] == {"uid1": 44, "uid2": 55, "uid3": 66, "device_id": 2}
+        on_done.assert_called_once_with(2)
+        self.assertEqual(bringup.stats["verified"], 1)
+        self.assertEqual(bringup.stats["duplicates"], 1)
+
+    def test_reconnect_does_not_trust_unit_reporting_first_request(self):
+        self._persist_previous_bus()
+        manager = self._build_manager()
+        shared_serial_mgr = manager.instances[0].serial_mgr
+        discovers = iter([
+            {"result": {"uid1": 11, "uid2": 22, "uid3": 33}},
+            {"result": {"uid1": 44, "uid2": 55, "uid3": 66}},
+        ])
+
+        def send_high_prio_request(request, callback):
+            command = request["command"]
+            if command == "GET_INFO":
+                callback({
+                    "device_id": request["target_device_id"],
+                    "code": 0,
+                    "result": {"first_request": True},
+                })
+            elif command == "DISCOVER_DEVICE":
+                callback(next(discovers))
+            else:
+                callback({"code": 0, "msg": "SUCCESS"})
+
+        shared_serial_mgr.send_high_prio_request.side_effect = send_high_prio_request
+        on_done = Mock()
+
+        bringup = manager._initialize_shared_bus_transport(manager.instances[0], on_done=on_done)
+
+        self.assertEqual(bringup.stats["verified"], 0)
+        self.assertEqual(bringup.stats["assigned"], 2)
+        on_done.assert_called_once_with(2)
+
+    def test_persisted_bindings_alone_do_not_count_as_discovered(self):
+        self._persist_previous_bus()
+        manager = self._build_manager()
+        shared_serial_mgr = manager.instances[0].serial_mgr
+        shared_serial_mgr.send_high_prio_request.side_effect = (
+            lambda request, callback: callback(None)
+        )
+        on_done = Mock()
+
+        manager._initialize_shared_bus_transport(manager.instances[0], on_done=on_done)
+
+        commands = {
+            call_args[0][0]["command"]
+            for call_args in shared_serial_mgr.send_high_prio_request.call_args_list
+        }
+        self.assertNotIn("ASSIGN_DEVICE_ID", commands)
+        self.mock_gcode.respond_info.assert_any_call(
+            "ACE[0]: ACE2 discovery returned no devices on shared bus"
+        )
+        on_done.assert_called_once_with(0)
+
+    def test_reconnect_cancels_bringup_still_in_progress(self):
+        manager = self._build_manager()
+        shared_serial_mgr = manager.instances[0].serial_mgr
+        pending = []
+        shared_serial_mgr.send_high_prio_request.side_effect = (
+            lambda request, callback: pending.append(callback)
+        )
+        first_done = Mock()
+
+        first = manager._initialize_shared_bus_transport(manager.instances[0], on_done=first_done)
+        stale_callbacks = list(pending)
+        second = manager._initialize_shared_bus_transport(manager.instances[0], on_done=Mock())
+
+        self.assertEqual(first.state, "cancelled")
+        for callback in stale_callbacks:
+            callback({"result": {"uid1": 11, "uid2": 22, "uid3": 33}})
+        first_done.assert_not_called()
+        self.assertEqual(manager.instances[0].bus_session.discovered_count(), 0)
+        self.assertEqual(second.state, "discovering")
 
     def test_initialize_shared_bus_transport_discards_stale_runtime_devices_before_restore(self):
         manager = self._build_manager()
@@ -693,6 +1060,23 @@ class TestSharedAce2Transport(unittest.TestCase):
 
         self.assertEqual(manager._on_shared_bus_connected.call_count, 2)
 
+    def test_shared_bus_unsolicited_routes_by_device_id(self):
+        manager = self._build_manager()
+        bus_session = manager.instances[0].bus_session
+        bus_session.bind_logical_instance(1, 44, 55, 66)
+        bus_session.assign_device_id(44, 55, 66, 2)
+        for instance in manager.instances:
+            instance.protocol = Mock()
+            instance.protocol.handle_bound_shared_bus_unsolicited.return_value = True
+        response = {"command": "GET_STATUS", "device_id": 2}
+
+        assert manager._handle_shared_bus_unsolicited(bus_session, response) is True
+        manager.instances[1].protocol.handle_bound_shared_bus_unsolicited.assert_called_once_with(
+            manager.instances[1], response
+        )
+        manager.instances[0].protocol.handle_bound_shared_bus_unsolicited.assert_not_called()
+        assert manager._handle_shared_bus_unsolicited(bus_session, {"device_id": 9}) is False
+
     def test_queue_shared_bus_instance_setup_enqueues_expected_requests(self):
         manager = self._build_manager()
         bus_session = manager.instances[0].bus_session
@@ -733,7 +1117,9 @@ class TestSharedAce2Transport(unittest.TestCase):
         manager = self._build_manager()
         bus_session = manager.instances[0].bus_session
 
-        manager._initialize_shared_bus_transport = Mock(return_value=0)
+        manager._initialize_shared_bus_transport = Mock(
+            side_effect=lambda instance, on_done: on_done(0)
+        )
         manager._queue_shared_bus_instance_setup = Mock()
         manager._start_shared_bus_runtime = Mock()
 
@@ -89,3 +89,26 @@ def test_handle_status_request_keeps_default_current_index_fallback_without_inst
 
     assert result["instance_index"] == 1
     assert result["temp"] == 45
+
+
+def test_handle_metrics_request_lists_transport_summary_per_instance():
+    comp = _build_component()
+
+    async def _query():
+        return {
+            "manager": {},
+            "instances": {
+                1: {"connection_state": "connected", "transport": {"rtt_avg_ms": 12.5, "crc_errors": 1}},
+                0: {"connection_state": "connected"},
+            },
+            "count": 2,
+        }
+
+    comp._query_ace_instances = _query
+
+    result = asyncio.run(comp.handle_metrics_request(_DummyWebRequest()))
+
+    assert result["ace_instance_count"] == 2
+    assert [entry["index"] for entry in result["instances"]] == [0, 1]
+    assert result["instances"][0]["transport"] == {}
+    assert result["instances"][1]["transport"]["crc_errors"] == 1
@@ -0,0 +1,92 @@
+"""Tests for the shared serial port inventory."""
+
+from types import SimpleNamespace
+
+from ace.port_inventory import AcePortInventory, port_location
+
+
+def _port(device, description="ACE", hwid="", **extra):
+    return SimpleNamespace(device=device, description=description, hwid=hwid, **extra)
+
+
+class TestPortLocation:
+    """USB location derivation used for topology sorting."""
+
+    def test_location_from_hwid(self):
+        assert port_location("/dev/ttyACM0", "USB VID:PID=28E9:018A LOCATION=1-1.3:1.0") == "1-1.3"
+
+    def test_acm_fallback(self):
+        assert port_location("/dev/ttyACM2", "n/a") == "acm.2"
+
+    def test_device_fallback(self):
+        assert port_location("/dev/ttyXYZ", "") == "/dev/ttyXYZ"
+
+
+class TestAcePortInventory:
+    """Caching and invalidation of the enumeration snapshot."""
+
+    def setup_method(self):
+        self.scans = 0
+        self.ports = [_port("/dev/ttyACM0", hwid="LOCATION=1-1.1")]
+
+        def lister():
+            self.scans += 1
+            return list(self.ports)
+
+        self.inventory = AcePortInventory(lister)
+
+    def test_enumerates_once_until_invalidated(self):
+        self.inventory.ports()
+        self.inventory.ports()
+        assert self.inventory.find("/dev/ttyACM0").location == "1-1.1"
+
+        assert self.scans == 1
+        assert self.inventory.snapshot()["hits"] == 2
+
+    def test_expire_shares_one_scan_per_tick(self):
+        clock = [0.0]
+        self.inventory._clock = lambda: clock[0]
+        for _ in range(3):  # three instances probing in the same tick
+            self.inventory.expire(0.2, "startup probe")
+            self.inventory.ports()
+        assert self.scans == 1
+
+        clock[0] = 0.25
+        self.inventory.expire(0.2, "startup probe")
+        self.inventory.ports()
+        assert self.scans == 2
+        assert self.inventory.snapshot()["last_invalidation"] == "startup probe"
+
+    def test_invalidate_rescans(self):
+        self.inventory.ports()
+        self.ports.append(_port("/dev/ttyACM1"))
+
+        self.inventory.invalidate("hotplug")
+
+        assert [p.device for p in self.inventory.ports()] == ["/dev/ttyACM0", "/dev/ttyACM1"]
+        snap = self.inventory.snapshot()
+        assert snap["scans"] == 2
+        assert snap["invalidations"] == 1
+        assert snap["last_invalidation"] == "hotplug"
+
+    def test_invalidate_without_snapshot_not_counted(self):
+        self.inventory.invalidate("connect wave")
+
+        assert self.inventory.snapshot()["invalidations"] == 0
+
+    def test_find_missing_device(self):
+        assert self.inventory.find("/dev/ttyUSB9") is None
+
+    def test_enumeration_error_returns_empty_and_retries(self):
+        def failing():
+            raise OSError("sysfs gone")
+
+        inventory = AcePortInventory(failing)
+
+        assert inventory.ports() == ()
+        assert inventory.snapshot()["scans"] == 0
+
+    def test_signature_falls_back_through_fields(self):
+        self.ports = [_port("/dev/ttyUSB0", description="", hwid="h", product="ACE2 USB-RS485")]
+
+        assert self.inventory.ports()[0].signature == "ACE2 USB-RS485"
@@ -1,12 +1,23 @@
 """Focused tests for protocol and ACE2 shared-bus scaffolding."""
 
+import copy
+import json
+import random
 import struct
 
 import pytest
 
 from ace.ace2_bus import Ace2BusSession
-from ace.protocol import resolve_protocol_name, transport_description_matches
-from ace.protocol_ace2 import ACE2_COMMAND_CATALOG, AceProtoProtocolAdapter
+from ace.protocol import AceFrameParser, resolve_protocol_name, transport_description_matches
+from ace.protocol_ace1 import AceJsonProtocolAdapter
+from ace.protocol_ace2 import (
+    ACE2_COMMAND_CATALOG,
+    ACE2_REQUEST_ENCODERS,
+    ACE2_RESPONSE_DECODERS,
+    Ace2StatusResult,
+    AceProtoProtocolAdapter,
+)
+from ace.transport_metrics import AceTransportMetrics
 
 
 def _calc_crc(buffer):
@@ -58,6 +69,35 @@ class TestAceProtoProtocolAdapter:
         assert transport.topology_validation is False
         assert transport.mode == "rs485-bus"
 
+    def test_coalesce_key_scoped_to_target_device(self):
+        status = self.adapter.build_get_status_request()
+        status_dev1 = dict(status, target_device_id=1)
+        status_dev2 = dict(status, target_device_id=2)
+        rfid = dict(self.adapter.build_get_filament_info_request(2), target_device_id=1)
+
+        assert self.adapter.get_coalesce_key(status_dev1) == ("GET_STATUS", 1, None)
+        assert self.adapter.get_coalesce_key(status_dev1) != self.adapter.get_coalesce_key(status_dev2)
+        assert self.adapter.get_coalesce_key(rfid) == ("GET_FILAMENT_INFO", 1, 2)
+        assert self.adapter.get_coalesce_key(self.adapter.build_start_feed_assist_request(0)) is None
+
+    def test_flow_key_is_target_device(self):
+        status = self.adapter.build_get_status_request()
+
+        assert self.adapter.get_request_flow_key(dict(status, target_device_id=3)) == 3
+        assert self.adapter.get_request_flow_key(status) is None
+        assert AceJsonProtocolAdapter().get_request_flow_key(
+            AceJsonProtocolAdapter().build_get_status_request()
+        ) is None
+
+    def test_timeout_hint_from_catalog(self):
+        status_request = self.adapter.build_get_status_request()
+        feed_request = self.adapter.build_feed_filament_request(0, 10, 10)
+
+        assert self.adapter.get_request_command_name(status_request) == "GET_STATUS"
+        assert self.adapter.get_request_timeout_hint(status_request) == 1.0
+        assert self.adapter.get_request_timeout_hint(feed_request) is None
+        assert self.adapter.get_request_timeout_hint({"command": "NOPE"}) is None
+
     def test_build_discover_device_request(self):
         request = self.adapter.build_discover_device_request()
 
@@ -218,15 +258,6 @@ class TestAceProtoProtocolAdapter:
                     "humidity": 40,
                     "feed_assist_count": 3,
                     "cont_assist_time": 12,
-                    "raw_fields": {
-                        1: [(0, 1)],
-                        2: [(2, b"\x08\x02\x10- Z")],
-                        3: [(0, 31)],
-                        4: [(0, 40)],
-                        7: [(0, 3)],
-                        8: [(0, 12)],
-                        9: [(2, b"\x08\x00\x10\x02"), (2, b"\x08\x01\x10\x02")],
-                    },
                     "slots": [
                         {
                             "index": 0,
@@ -284,11 +315,6 @@ class TestAceProtoProtocolAdapter:
                     "humidity": 0,
                     "feed_assist_count": 0,
                     "cont_assist_time": 0,
-                    "raw_fields": {
-                        1: [(0, 77)],
-                        2: [(2, b"\x08c\x10(")],
-                        9: [(2, b"\x08\x8c\x01\x10\x01")],
-                    },
                     "slots": [
                         {
                             "index": 0,
@@ -387,6 +413,194 @@ class TestAceProtoProtocolAdapter:
             assert frame.endswith(b"\xFE")
 
 
+class TestAce2GeneratedCodecs:
+    """Generated per-message codecs must match the generic reference path."""
+
+    REQUEST_PARAMS = {
+        "index": 2, "speed": 300, "length": 1200, "mode": 1, "temp": 55, "duration": 240,
+        "auto_roll": True, "uid1": 0x12345678, "uid2": 7, "uid3": 0xFFFFFFFF, "device_id": 3,
+        "enable": False, "id": 1, "type": 2, "check_length": 40, "error_length": 90,
+        "power": 128, "valve1": True, "valve2": False, "components": 5, "loop": 3,
+        "quick1": 100, "slow1": 500, "quick2": 0, "slow2": 1000, "fan1": True, "fan2": True,
+        "state": 1,
+    }
+
+    def setup_method(self):
+        self.adapter = AceProtoProtocolAdapter()
+
+    def _expected(self, command, payload):
+        expected = self.adapter._decode_response_payload_reference(command, payload)
+        if command == "GET_STATUS":
+            expected["result"].pop("raw_fields")
+        return expected
+
+    def _random_message(self, rng, command):
+        def uint():
+            return rng.choice([0, 1, 2, 127, 128, 300, rng.randrange(1 << 32)])
+
+        def fields(numbers, nested=None):
+            out = []
+            for number in numbers:
+                for _ in range(rng.choice([0, 1, 1, 1, 2])):
+                    if nested and number in nested:
+                        out.append(_pb_bytes(number, nested[number]()))
+                    else:
+                        out.append(_pb_uint(number, uint()))
+            if rng.random() < 0.3:
+                out.append(_pb_uint(rng.randrange(20, 40), uint()))
+            if rng.random() < 0.3:
+                out.append(_pb_bytes(rng.randrange(20, 40), bytes(rng.randrange(256) for _ in range(5))))
+            rng.shuffle(out)
+            return b"".join(out)
+
+        if command == "GET_STATUS":
+            return fields(
+                [1, 2, 3, 4, 7, 8, 9] + [9] * rng.randrange(4),
+                {2: lambda: fields([1, 2, 3, 4]), 9: lambda: fields([1, 2])},
+            )
+        if command == "GET_FILAMENT_INFO":
+            payload = fields(
+                [1, 2, 5, 5, 6, 7, 9, 10, 11, 12],
+                {5: lambda: fields([1]), 6: lambda: fields([1, 2, 3, 4]), 7: lambda: fields([1, 2])},
+            )
+            diameter = rng.choice([b"", b"\x45" + struct.pack("<f", 1.75), _pb_uint(8, 2)])
+            return payload + _pb_bytes(3, b"SKU-1") + _pb_bytes(4, b"PLA\xff") + diameter
+        if command == "DISCOVER_DEVICE":
+            return fields([1, 2, 3])
+        return fields([1])
+
+    def test_every_schema_command_has_generated_codecs(self):
+        for spec in ACE2_COMMAND_CATALOG:
+            assert spec.name in ACE2_REQUEST_ENCODERS
+        for command in ("DISCOVER_DEVICE", "GET_STATUS", "GET_FILAMENT_INFO", "FEED_OR_ROLLBACK"):
+            assert command in ACE2_RESPONSE_DECODERS
+
+    def test_request_encoders_match_reference(self):
+        for spec in ACE2_COMMAND_CATALOG:
+            expected = self.adapter._encode_request_payload_reference(spec.name, self.REQUEST_PARAMS)
+            assert self.adapter._encode_request_payload(spec.name, self.REQUEST_PARAMS) == expected
+
+    def test_request_encoders_keep_optional_default_and_required_keys(self):
+        assert self.adapter._encode_request_payload("DRYING", {"temp": 50, "duration": 60}) == (
+            self.adapter._encode_request_payload_reference("DRYING", {"temp": 50, "duration": 60})
+        )
+        with pytest.raises(KeyError):
+            self.adapter._encode_request_payload("FEED_OR_ROLLBACK", {"index": 0, "speed": 10})
+
+    def test_random_valid_payloads_match_reference(self):
+        rng = random.Random(2021)
+        commands = ["GET_STATUS", "GET_FILAMENT_INFO", "DISCOVER_DEVICE", "FEED_OR_ROLLBACK"]
+        for _ in range(500):
+            command = rng.choice(commands)
+            payload = self._random_message(rng, command)
+            assert self.adapter._decode_response_payload(command, payload) == self._expected(command, payload)
+
+    def test_malformed_payloads_fall_back_to_reference(self):
+        rng = random.Random(7)
+        cases = [
+            _pb_bytes(3, b"31"),                       # known field on the wrong wire type
+            _pb_uint(1, 1) + b"\x18\x80",              # truncated varint
+            _pb_uint(1, 1) + b"\x12\x09\x08",          # truncated nested message
+            _pb_uint(1, 1) + b"\x0b\x01",              # group wire type
+        ]
+        cases += [bytes(rng.randrange(256) for _ in range(rng.randrange(1, 24))) for _ in range(300)]
+        for payload in cases:
+            try:
+                expected = self._expected("GET_STATUS", payload)
+            except Exception as e:
+                with pytest.raises(type(e)):
+                    self.adapter._decode_response_payload("GET_STATUS", payload)
+                continue
+            decoded = self.adapter._decode_response_payload("GET_STATUS", payload)
+            # Fallback results carry raw_fields; that is where they help most
+            decoded["result"].pop("raw_fields", None)
+            assert decoded == expected
+
+    def test_include_raw_fields_keeps_generic_field_dict(self):
+        payload = _pb_uint(1, 1) + _pb_uint(3, 31) + _pb_uint(5, 9)
+        assert "raw_fields" not in self.adapter._decode_response_payload("GET_STATUS", payload)["result"]
+
+        self.adapter.include_raw_fields = True
+        result = self.adapter._decode_response_payload("GET_STATUS", payload)["result"]
+        assert result["raw_fields"] == {1: [(0, 1)], 3: [(0, 31)], 5: [(0, 9)]}
+        assert result["temp"] == 31
+
+
+class TestAce2StatusResult:
+    """GET_STATUS results decode the dryer block and slot array on first use."""
+
+    DRYER = _pb_uint(1, 2) + _pb_uint(2, 45) + _pb_uint(4, 90)
+    SLOT = _pb_uint(1, 1) + _pb_uint(2, 2)
+
+    def setup_method(self):
+        self.adapter = AceProtoProtocolAdapter()
+        self.payload = (
+            _pb_uint(1, 1) + _pb_bytes(2, self.DRYER) + _pb_uint(3, 31)
+            + _pb_bytes(9, self.SLOT) + _pb_bytes(9, b"")
+        )
+
+    def _result(self, payload=None):
+        return self.adapter._decode_response_payload("GET_STATUS", payload or self.payload)["result"]
+
+    def _reference(self, payload=None):
+        result = self.adapter._decode_response_payload_reference("GET_STATUS", payload or self.payload)["result"]
+        result.pop("raw_fields")
+        return result
+
+    def test_nested_fields_decode_on_access(self):
+        result = self._result()
+
+        assert isinstance(result, Ace2StatusResult)
+        assert result["temp"] == 31
+        assert "slots" in result and "dryer_status" in result
+        assert len(result) == 8
+        assert sorted(result._pending) == ["dryer_status", "slots"]
+
+        assert result.get("dryer_status") == self._reference()["dryer_status"]
+        assert result._pending == ["slots"]
+        assert result["slots"][1] == {
+            "index": 1, "status": "empty", "status_detail": "empty", "status_code": 0, "rfid": 0,
+        }
+        assert result._pending == []
+
+    def test_behaves_like_the_reference_dict(self):
+        reference = self._reference()
+
+        assert self._result() == reference
+        assert reference == self._result()
+        assert dict(self._result()) == reference
+        assert list(self._result()) == list(reference)
+        assert json.dumps(self._result()) == json.dumps(reference)
+        assert copy.deepcopy(self._result()) == reference
+        assert type(copy.deepcopy(self._result())) is dict
+
+    def test_mutation_materialises_first(self):
+        result = self._result()
+        result.pop("temp")
+        result["extra"] = 1
+
+        assert result["slots"] == self._reference()["slots"]
+        assert "temp" not in result
+        assert list(result)[-1] == "extra"
+
+    def test_malformed_nested_payload_uses_generic_reading(self):
+        payload = _pb_uint(1, 1) + _pb_bytes(2, b"\x08\x02\x10") + _pb_bytes(9, _pb_bytes(1, b"x") + _pb_uint(2, 0))
+
+        assert self._result(payload) == self._reference(payload)
+
+    def test_frame_parser_reports_decode_time(self):
+        metrics = AceTransportMetrics(window_size=4)
+        parser = AceFrameParser(self.adapter, _calc_crc, metrics=metrics)
+        inner = b"\x81\x01\x00\x06" + bytes([len(self.payload)]) + self.payload
+        parser.append(b"\xFF\xAA" + inner + struct.pack("<H", _calc_crc(inner)) + b"\xFE")
+
+        responses, _ = parser.parse()
+
+        assert len(responses) == 1
+        assert metrics.decode_frames == 1
+        assert metrics.snapshot()["decode"]["max_us"] > 0
+
+
 class TestAce2BusSession:
     """Test shared-bus device tracking for ACE2 scaffolding."""
 
@@ -422,6 +636,229 @@ class TestAce2BusSession:
 
         assert list(session.iter_discovered_devices()) == []
         assert session.get_device_for_instance(1) is None
+        assert session.get_device_for_device_id(7) is None
+
+    def test_device_id_index_follows_reassignment(self):
+        session = Ace2BusSession(port="/dev/ttyUSB0")
+        first = session.assign_device_id(10, 20, 30, 1)
+        second = session.assign_device_id(40, 50, 60, 2)
+
+        session.assign_device_id(10, 20, 30, 3)
+        assert session.get_device_for_device_id(1) is None
+        assert session.get_device_for_device_id(3) is first
+
+        # An id addresses one unit: taking it clears the previous holder
+        session.assign_device_id(10, 20, 30, 2)
+        assert session.get_device_for_device_id(2) is first
+        assert second.device_id is None
+
+        session.clear_device_id(first)
+        assert session.get_device_for_device_id(2) is None
+        assert first.device_id is None
+
+    def test_instance_index_follows_rebinding(self):
+        session = Ace2BusSession(port="/dev/ttyUSB0")
+        first = session.bind_logical_instance(0, 10, 10, 10)
+        second = session.bind_logical_instance(0, 20, 20, 20)
+
+        assert first.logical_instance is None
+        assert session.get_device_for_instance(0) is second
+
+        session.bind_logical_instance(1, 20, 20, 20)
+        assert session.get_device_for_instance(0) is None
+        assert session.get_device_for_instance(1) is second
+        assert session.export_bindings() == {1: (20, 20, 20)}
+
+    def test_assignment_plan_skips_ids_in_use_and_follows_rebinding(self):
+        session = Ace2BusSession(port="/dev/ttyUSB0")
+        session.record_discovered_device(30, 30, 30)
+        session.record_discovered_device(20, 20, 20)
+        session.assign_device_id(10, 10, 10, 1)
+        assert [d.identity.uid_tuple for d in session.build_assignment_plan()] == [
+            (10, 10, 10), (20, 20, 20), (30, 30, 30),
+        ]
+        assert session.get_device_for_device_id(2).identity.uid_tuple == (20, 20, 20)
+
+        # A later binding reorders the cached plan
+        session.bind_logical_instance(0, 30, 30, 30)
+        assert session.build_assignment_plan()[0].identity.uid_tuple == (30, 30, 30)
+        assert [d.identity.uid_tuple for d in session.iter_discovered_devices()] == [
+            (10, 10, 10), (20, 20, 20), (30, 30, 30),
+        ]
+
+
+def _ace1_frame(payload_dict):
+    """Build one ACE1 JSON response frame."""
+    payload = json.dumps(payload_dict).encode("utf-8")
+    return (
+        b"\xFF\xAA" + struct.pack("<H", len(payload)) + payload
+        + struct.pack("<H", _calc_crc(payload)) + b"\xFE"
+    )
+
+
+class TestAceFrameParser:
+    """Incremental in-place frame parsing shared by both adapters."""
+
+    def setup_method(self):
+        self.parser = AceFrameParser(AceJsonProtocolAdapter(), _calc_crc)
+
+    def test_parses_back_to_back_frames(self):
+        self.parser.append(_ace1_frame({"id": 1}) + _ace1_frame({"id": 2}))
+
+        responses, notices = self.parser.parse()
+
+        assert [r["id"] for r in responses] == [1, 2]
+        assert notices == []
+        assert len(self.parser) == 0
+
+    def test_partial_frame_resumes_without_rescan(self):
+        frame = _ace1_frame({"id": 3, "result": {"status": "ready"}})
+        self.parser.append(frame[:10])
+
+        responses, _ = self.parser.parse()
+
+        assert responses == []
+        assert self.parser.pending_frame_length() == len(frame)
+
+        self.parser.append(frame[10:])
+        responses, notices = self.parser.parse()
+
+        assert responses == [{"id": 3, "result": {"status": "ready"}}]
+        assert notices == []
+        assert self.parser.pending_frame_length() == 0
+
+    def test_byte_at_a_time_feed(self):
+        frames = _ace1_frame({"id": 1}) + _ace1_frame({"id": 2})
+        seen = []
+        for i in range(len(frames)):
+            self.parser.append(frames[i:i + 1])
+            responses, notices = self.parser.parse()
+            assert notices == []
+            seen.extend(r["id"] for r in responses)
+
+        assert seen == [1, 2]
+
+    def test_junk_between_frames_resyncs(self):
+        self.parser.append(b"\x01\x02\x03" + _ace1_frame({"id": 1}) + b"zz" + _ace1_frame({"id": 2}))
+
+        responses, notices = self.parser.parse()
+
+        assert [r["id"] for r in responses] == [1, 2]
+        assert notices == ["Resync: skipping 3 bytes", "Resync: skipping 2 bytes"]
+
+    def test_bad_tail_skips_to_next_header(self):
+        bad = bytearray(_ace1_frame({"id": 1}))
+        bad[-1] = 0x00
+        self.parser.append(bytes(bad) + _ace1_frame({"id": 2}))
+
+        responses, notices = self.parser.parse()
+
+        assert [r["id"] for r in responses] == [2]
+        assert "Invalid frame tail, resyncing" in notices
+
+    def test_compacts_consumed_bytes(self):
+        frame = _ace1_frame({"id": 1})
+        self.parser.append(frame + frame[:5])
+
+        self.parser.parse()
+
+        assert self.parser._offset == 0
+        assert self.parser.pending() == bytearray(frame[:5])
+
+    def test_ace2_frames_parse_incrementally(self):
+        parser = AceProtoProtocolAdapter().create_frame_parser(_calc_crc)
+        payload = _pb_uint(1, 0)
+        inner = b"\x80\x05\x00\x08" + bytes([len(payload)]) + payload
+        frame = b"\xFF\xAA" + inner + struct.pack("<H", _calc_crc(inner)) + b"\xFE"
+
+        parser.append(frame[:6])
+        assert parser.parse() == ([], [])
+        parser.append(frame[6:])
+        responses, notices = parser.parse()
+
+        assert notices == []
+        assert responses[0]["id"] == 5
+        assert responses[0]["command"] == "FEED_OR_ROLLBACK"
+
+
+class TestAceJsonFrameTemplates:
+    """Cached ACE1 request frames must match json.dumps byte-for-byte."""
+
+    def setup_method(self):
+        self.adapter = AceJsonProtocolAdapter()
+
+    def _uncached_frame(self, request):
+        payload = json.dumps(request).encode("utf-8")
+        return (
+            b"\xFF\xAA" + struct.pack("<H", len(payload)) + payload
+            + struct.pack("<H", _calc_crc(payload)) + b"\xFE"
+        )
+
+    @pytest.mark.parametrize("request_dict", [
+        {"method": "get_status", "id": 0},
+        {"method": "get_status", "id": 65535},
+        {"method": "get_info", "id": 12},
+        {"method": "start_feed_assist", "params": {"index": 3}, "id": 99},
+        {"method": "get_filament_info", "params": {"index": 0}, "id": 1234567},
+        {"method": "drying_stop", "params": {}, "id": 4},
+    ])
+    def test_cached_frame_matches_json_encoding(self, request_dict):
+        first = self.adapter.serialize_request_frame(dict(request_dict), _calc_crc)
+        again = dict(request_dict)
+        again["id"] = request_dict["id"] + 1
+        second = self.adapter.serialize_request_frame(again, _calc_crc)
+
+        assert first == self._uncached_frame(request_dict)
+        assert second == self._uncached_frame(again)
+
+    def test_heartbeat_hits_cache(self):
+        for request_id in range(5):
+            request = self.adapter.build_get_status_request()
+            request["id"] = request_id
+            self.adapter.serialize_request_frame(request, _calc_crc)
+
+        stats = self.adapter.get_frame_cache_stats()
+        assert stats["misses"] == 1
+        assert stats["hits"] == 4
+        assert stats["templates"] == 1
+
+    def test_slot_index_keys_separate_templates(self):
+        for slot in range(4):
+            request = self.adapter.build_start_feed_assist_request(slot)
+            request["id"] = slot
+            frame = self.adapter.serialize_request_frame(request, _calc_crc)
+            assert frame == self._uncached_frame(request)
+
+        assert self.adapter.get_frame_cache_stats()["templates"] == 4
+
+    @pytest.mark.parametrize("request_dict", [
+        {"method": "feed_filament", "params": {"index": 0, "length": 10, "speed": 25}, "id": 1},
+        {"method": "get_status"},
+        {"id": 3, "method": "get_status"},
+        {"method": "get_status", "id": "7"},
+    ])
+    def test_uncacheable_requests_fall_back_to_json(self, request_dict):
+        frame = self.adapter.serialize_request_frame(dict(request_dict), _calc_crc)
+
+        assert frame == self._uncached_frame(request_dict)
+        assert self.adapter.get_frame_cache_stats()["uncacheable"] == 1
+        assert self.adapter.get_frame_cache_stats()["templates"] == 0
+
+
+class TestAceJsonTimeoutHints:
+    """ACE1 requests carry no timeout hints; they start from the fixed timeout."""
+
+    def test_status_and_info_have_no_hint(self):
+        adapter = AceJsonProtocolAdapter()
+
+        assert adapter.get_request_command_name({"method": "get_status"}) == "get_status"
+        assert adapter.get_request_timeout_hint(adapter.build_get_status_request()) is None
+        assert adapter.get_request_timeout_hint(adapter.build_get_info_request()) is None
+
+    def test_motion_methods_have_no_hint(self):
+        adapter = AceJsonProtocolAdapter()
+
+        assert adapter.get_request_timeout_hint(adapter.build_feed_filament_request(0, 10, 10)) is None
 
 
 class TestTransportDescriptionMatching:
@@ -0,0 +1,120 @@
+"""Tests for the priority/aging request scheduler."""
+
+import pytest
+
+from ace.request_scheduler import AceRequestScheduler
+
+
+class TestAceRequestScheduler:
+    """Ordering, aging, staleness and stats of the pending-request heap."""
+
+    def setup_method(self):
+        self.now = 0.0
+        self.sched = AceRequestScheduler(maxsize=8, clock=lambda: self.now)
+
+    def _pop_request(self):
+        (request, _), _ = self.sched.pop()
+        return request
+
+    def test_high_priority_before_normal(self):
+        self.sched.push("normal", None, AceRequestScheduler.NORMAL)
+        self.sched.push("high", None, AceRequestScheduler.HIGH)
+
+        assert self._pop_request() == "high"
+        assert self._pop_request() == "normal"
+        assert self._pop_request() is None
+
+    def test_fifo_within_class(self):
+        for name in ("a", "b", "c"):
+            self.sched.push(name, None, AceRequestScheduler.NORMAL)
+
+        assert [self._pop_request() for _ in range(3)] == ["a", "b", "c"]
+
+    def test_aged_normal_overtakes_new_high(self):
+        self.sched.push("old-normal", None, AceRequestScheduler.NORMAL)
+        self.now = AceRequestScheduler.AGING_OFFSETS[AceRequestScheduler.NORMAL] + 0.1
+        self.sched.push("new-high", None, AceRequestScheduler.HIGH)
+
+        assert self._pop_request() == "old-normal"
+
+    def test_stale_entries_returned_separately(self):
+        self.sched.push("poll", "poll-cb", AceRequestScheduler.HIGH, max_wait=1.0)
+        self.sched.push("feed", "feed-cb", AceRequestScheduler.NORMAL)
+        self.now = 1.5
+
+        entry, stale = self.sched.pop()
+
+        assert entry == ("feed", "feed-cb")
+        assert stale == [("poll", "poll-cb")]
+        assert len(self.sched) == 0
+
+    def test_not_stale_within_max_wait(self):
+        self.sched.push("poll", None, AceRequestScheduler.HIGH, max_wait=1.0)
+        self.now = 1.0
+
+        entry, stale = self.sched.pop()
+
+        assert entry == ("poll", None)
+        assert stale == []
+
+    def test_full_rejects_push(self):
+        for i in range(8):
+            assert self.sched.push(i, None)
+
+        assert not self.sched.push("overflow", None)
+        assert self.sched.snapshot()["rejected"] == 1
+
+    def test_clear_returns_entries_in_order(self):
+        self.sched.push("n", "n-cb", AceRequestScheduler.NORMAL)
+        self.sched.push("h", "h-cb", AceRequestScheduler.HIGH)
+
+        assert self.sched.clear() == [("h", "h-cb"), ("n", "n-cb")]
+        assert len(self.sched) == 0
+        assert self.sched.qsize(AceRequestScheduler.HIGH) == 0
+
+    def test_wait_stats_per_class(self):
+        self.sched.push("h1", None, AceRequestScheduler.HIGH)
+        self.sched.push("n1", None, AceRequestScheduler.NORMAL)
+        self.now = 0.2
+        self._pop_request()
+        self.now = 0.5
+        self._pop_request()
+
+        snap = self.sched.snapshot()
+
+        assert snap["high"]["dequeued"] == 1
+        assert snap["high"]["avg_wait_s"] == pytest.approx(0.2)
+        assert snap["normal"]["max_wait_s"] == pytest.approx(0.5)
+        assert snap["peak_depth"] == 2
+        assert snap["depth"] == 0
+
+    def test_flows_served_round_robin(self):
+        for i in range(3):
+            self.sched.push(f"dev1-{i}", None, AceRequestScheduler.NORMAL, flow=1)
+        self.sched.push("dev2-0", None, AceRequestScheduler.NORMAL, flow=2)
+
+        assert [self._pop_request() for _ in range(4)] == ["dev1-0", "dev2-0", "dev1-1", "dev1-2"]
+
+    def test_urgent_head_preferred_across_flows(self):
+        self.sched.push("dev1-normal", None, AceRequestScheduler.NORMAL, flow=1)
+        self.sched.push("dev2-high", None, AceRequestScheduler.HIGH, flow=2)
+
+        assert self._pop_request() == "dev2-high"
+
+    def test_capped_flow_skipped_while_others_have_work(self):
+        self.sched.push("dev1-high", None, AceRequestScheduler.HIGH, flow=1)
+        self.sched.push("dev2-normal", None, AceRequestScheduler.NORMAL, flow=2)
+
+        (request, _), _ = self.sched.pop(capped={1})
+        assert request == "dev2-normal"
+
+        # Work-conserving: a capped flow is still served when it is the only one
+        (request, _), _ = self.sched.pop(capped={1})
+        assert request == "dev1-high"
+
+    def test_flow_snapshot(self):
+        self.sched.push("a", None, flow=1)
+        self.sched.push("b", None, flow=1)
+        self._pop_request()
+
+        assert self.sched.snapshot()["flows"] == {1: {"queued": 1, "dispatched": 1}}
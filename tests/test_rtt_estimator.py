@@ -0,0 +1,84 @@
+"""Tests for per-command round-trip estimation and adaptive timeouts."""
+
+import pytest
+
+from ace.rtt_estimator import AceRttEstimator
+
+
+class TestAceRttEstimator:
+    """Adaptive timeout derivation from round-trip samples."""
+
+    def setup_method(self):
+        self.est = AceRttEstimator(default_timeout_s=5.0)
+
+    def test_unknown_command_uses_hint_then_default(self):
+        assert self.est.timeout_for("get_status", 1.0) == 1.0
+        assert self.est.timeout_for("get_status") == 5.0
+        assert self.est.timeout_for(None, 2.0) == 2.0
+
+    def test_seed_used_until_min_samples(self):
+        for _ in range(AceRttEstimator.MIN_SAMPLES - 1):
+            self.est.observe("get_status", 0.02)
+
+        assert self.est.timeout_for("get_status", 1.0) == 1.0
+
+    def test_fast_command_recycles_in_hundreds_of_ms(self):
+        for _ in range(20):
+            self.est.observe("get_status", 0.02)
+
+        assert self.est.timeout_for("get_status", 1.0) == pytest.approx(AceRttEstimator.MIN_TIMEOUT_S)
+
+    def test_slow_command_extends_beyond_default(self):
+        for rtt in (6.0, 7.0, 8.0, 6.5, 7.5):
+            self.est.observe("unwind_filament", rtt)
+
+        timeout = self.est.timeout_for("unwind_filament")
+        assert timeout > 8.0
+        assert timeout <= AceRttEstimator.MAX_TIMEOUT_S
+
+    def test_variance_widens_timeout(self):
+        steady = AceRttEstimator(5.0)
+        jittery = AceRttEstimator(5.0)
+        for _ in range(10):
+            steady.observe("get_info", 0.5)
+        for rtt in (0.1, 0.9) * 5:
+            jittery.observe("get_info", rtt)
+
+        assert jittery.timeout_for("get_info") > steady.timeout_for("get_info")
+
+    def test_timeout_backs_off_until_next_sample(self):
+        for _ in range(10):
+            self.est.observe("get_status", 0.02)
+        base = self.est.timeout_for("get_status")
+
+        self.est.on_timeout("get_status")
+        assert self.est.timeout_for("get_status") == pytest.approx(base * 2)
+        self.est.on_timeout("get_status")
+        assert self.est.timeout_for("get_status") == pytest.approx(base * 4)
+
+        self.est.observe("get_status", 0.02)
+        assert self.est.timeout_for("get_status") == pytest.approx(base)
+
+    def test_backoff_capped(self):
+        for _ in range(10):
+            self.est.on_timeout("get_status")
+
+        assert self.est.timeout_for("get_status", 1.0) == pytest.approx(AceRttEstimator.MAX_BACKOFF)
+
+    def test_disabled_ignores_samples_and_hint(self):
+        est = AceRttEstimator(5.0, enabled=False)
+        for _ in range(10):
+            est.observe("get_status", 0.02)
+
+        assert est.timeout_for("get_status", 1.0) == 5.0
+        assert est.timeout_for("get_status") == 5.0
+
+    def test_snapshot_reports_per_command(self):
+        self.est.observe("get_status", 0.02)
+        self.est.on_timeout("get_info")
+
+        snap = self.est.snapshot()
+
+        assert snap["get_status"]["samples"] == 1
+        assert snap["get_status"]["srtt"] == pytest.approx(0.02)
+        assert snap["get_info"]["timeouts"] == 1
@@ -0,0 +1,158 @@
+"""Tests for the dedicated serial I/O thread."""
+
+import json
+import os
+import struct
+import threading
+import time
+
+from ace.crc import crc16_mcrf4xx as _crc
+from ace.protocol import AceFrameParser
+from ace.protocol_ace1 import AceJsonProtocolAdapter
+from ace.serial_io_thread import AceSerialIoThread
+
+
+def _frame(payload_dict):
+    payload = json.dumps(payload_dict).encode("utf-8")
+    return (b"\xFF\xAA" + struct.pack("<H", len(payload)) + payload +
+            struct.pack("<H", _crc(payload)) + b"\xFE")
+
+
+class PipePort:
+    """Serial stand-in: reads from one pipe, records writes."""
+
+    def __init__(self):
+        self.read_fd, self.device_fd = os.pipe()
+        self.written = []
+        self.write_error = None
+        self.write_gate = None  # threading.Event: write() blocks until set
+        self.closed = 0
+
+    def fileno(self):
+        return self.read_fd
+
+    def read(self, size=1):
+        return os.read(self.read_fd, size)
+
+    def write(self, data):
+        if self.write_gate is not None:
+            self.write_gate.wait()
+        if self.write_error is not None:
+            raise self.write_error
+        self.written.append(data)
+
+    def feed(self, data):
+        os.write(self.device_fd, data)
+
+    def close(self):
+        self.closed += 1
+        for fd in (self.read_fd, self.device_fd):
+            try:
+                os.close(fd)
+            except OSError:
+                pass
+
+
+def _wait_for(predicate, timeout=2.0):
+    deadline = time.monotonic() + timeout
+    while time.monotonic() < deadline:
+        if predicate():
+            return True
+        time.sleep(0.005)
+    return False
+
+
+class TestAceSerialIoThread:
+    """Port I/O and parsing off the reactor thread."""
+
+    def setup_method(self):
+        self.port = PipePort()
+        self.wakes = []
+        self.io = AceSerialIoThread(
+            self.port,
+            AceFrameParser(AceJsonProtocolAdapter(), _crc),
+            wake=lambda: self.wakes.append(threading.current_thread().name),
+            name="test-serial-io",
+        )
+        self.io.start()
+
+    def teardown_method(self):
+        if self.port.write_gate is not None:
+            self.port.write_gate.set()
+        self.io.stop()
+        _wait_for(self.io.join)
+        self.port.close()
+
+    def test_parsed_response_handed_to_reactor(self):
+        self.port.feed(_frame({"id": 7, "code": 0, "result": {}}))
+
+        assert _wait_for(lambda: len(self.io.rx) == 1)
+        assert self.io.rx.popleft() == ("response", {"id": 7, "code": 0, "result": {}})
+        assert self.wakes == ["test-serial-io"]
+        assert self.io.frames_read == 1
+
+    def test_one_wake_per_batch_until_acknowledged(self):
+        self.port.feed(_frame({"id": 1}) + _frame({"id": 2}))
+        assert _wait_for(lambda: len(self.io.rx) == 2)
+        assert len(self.wakes) == 1
+
+        self.io.acknowledge_wake()
+        self.io.rx.clear()
+        self.port.feed(_frame({"id": 3}))
+        assert _wait_for(lambda: len(self.wakes) == 2)
+
+    def test_send_writes_on_io_thread(self):
+        self.io.send(5, b"frame")
+
+        assert _wait_for(lambda: self.port.written == [b"frame"])
+        assert self.io.frames_written == 1
+        assert not self.io.rx
+
+    def test_tx_counted_only_after_write_succeeds(self):
+        from ace.transport_metrics import AceTransportMetrics
+
+        self.io.metrics = AceTransportMetrics(4)
+        self.port.write_error = RuntimeError("stalled")
+        self.io.send(1, b"lost")
+        assert _wait_for(lambda: len(self.io.rx) == 1)
+        assert self.io.metrics.tx_frames == 0
+
+        self.port.write_error = None
+        self.io.send(2, b"frame")
+        assert _wait_for(lambda: self.io.metrics.tx_frames == 1)
+        assert self.io.metrics.tx_bytes == len(b"frame")
+
+    def test_write_failure_reported_with_request_id(self):
+        self.port.write_error = RuntimeError("stalled")
+        self.io.send(9, b"frame")
+
+        assert _wait_for(lambda: len(self.io.rx) == 1)
+        kind, error, request_id = self.io.rx.popleft()
+        assert kind == "write_error"
+        assert str(error) == "stalled"
+        assert request_id == 9
+
+    def test_stop_lets_thread_close_port_and_join_reaps(self):
+        assert self.io.running
+        self.io.stop()
+
+        assert _wait_for(self.io.join)
+        assert not self.io.running
+        assert self.port.closed == 1
+        self.io.send(1, b"late")
+        assert self.port.written == []
+
+    def test_stop_does_not_wait_for_stalled_write(self):
+        self.port.write_gate = threading.Event()
+        self.io.send(1, b"stuck")
+        assert _wait_for(lambda: not self.io.tx)
+
+        started = time.monotonic()
+        self.io.stop()
+        assert time.monotonic() - started < 0.1
+        assert not self.io.join()
+        assert self.port.closed == 0
+
+        self.port.write_gate.set()
+        assert _wait_for(self.io.join)
+        assert self.port.closed == 1
@@ -7,8 +7,8 @@ Focus: Testing actual production code without heavy I/O mocking.
 - Frame parsing
 - Status update change detection
 """
+import collections
 import pytest
-import queue
 from types import SimpleNamespace
 import struct
 import json
@@ -202,6 +202,27 @@ class TestFindComPort:
         result = self.manager.find_com_port("ACE", instance=0)
         assert result is None
 
+    def test_reuses_cached_enumeration_until_connect_fails(self):
+        scans = []
+        ports = [SimpleNamespace(device="/dev/ttyUSB0", description="ACE", hwid="LOCATION=1-1.1")]
+
+        def comports():
+            scans.append(1)
+            return ports
+
+        self.serial_mod.tools.list_ports.comports = comports
+        self.manager.connect = Mock(return_value=False)
+
+        self.manager.find_com_port("ACE", instance=0)
+        self.manager._get_usb_location_for_port("/dev/ttyUSB0")
+        assert len(scans) == 1
+
+        assert self.manager.auto_connect(0, 115200) is False
+        assert self.manager.port_inventory.last_invalidation == "connect failed"
+
+        self.manager.find_com_port("ACE", instance=0)
+        assert len(scans) == 2
+
     def test_does_not_match_ace2_transport_when_looking_for_ace1(self):
         ports = [SimpleNamespace(device="/dev/ttyUSB9", description="ACE2 USB-RS485", hwid="LOCATION=1-1.1")]
         self.serial_mod.tools.list_ports.comports = lambda: ports
@@ -718,10 +739,69 @@ class TestReader:
         assert ret == 3.0 + 0.05
         assert any("Invalid CRC" in args[0] for args, _ in self.mock_gcode.respond_info.call_args_list)
         self.manager.dispatch_response.assert_not_called()
+        metrics = self.manager.metrics.snapshot()
+        assert metrics["errors"]["crc"] == 1
+        assert metrics["rx"] == {"frames": 0, "bytes": len(bad_crc_frame)}
+
+    def test_fd_reader_dispatches_frame(self):
+        frame = self._make_frame({"id": 1, "ok": 1})
+        self.manager._serial.read.return_value = frame
+        cb = Mock()
+        self.manager.dispatch_response.return_value = (cb, True)
+
+        self.manager._fd_reader(eventtime=1.0)
+
+        cb.assert_called_once_with(response={"id": 1, "ok": 1})
+        assert self.manager._reader_wakeups == 1
+        assert self.manager._reader_empty_wakeups == 0
+
+    def test_fd_reader_empty_read_counted(self):
+        self.manager._serial.read.return_value = b""
+
+        self.manager._fd_reader(eventtime=1.0)
+
+        assert self.manager._reader_wakeups == 1
+        assert self.manager._reader_empty_wakeups == 1
+
+    def test_fd_reader_serial_exception_unregisters_fd(self):
+        self.manager._ace_pro_enabled = True
+        import ace.serial_manager as sm
+        sm.SerialException = BaseException
+        self.manager._serial.read = Mock(side_effect=BaseException("boom"))
+        self.manager.connect_timer = None
+        handle = Mock()
+        self.manager.reader_fd_handle = handle
+
+        self.manager._fd_reader(eventtime=0.0)
+
+        self.mock_reactor.unregister_fd.assert_called_once_with(handle)
+        assert self.manager.reader_fd_handle is None
+        self.manager.reconnect.assert_called_once_with()
+
+    def test_reentrant_read_parsed_by_outer_dispatch(self):
+        """Bytes arriving while a callback pauses are dispatched after it returns."""
+        first = self._make_frame({"id": 1})
+        second = self._make_frame({"id": 2})
+        seen = []
+
+        def cb(response):
+            seen.append(response["id"])
+            if response["id"] == 1:
+                # Simulates the fd firing again during a reactor pause
+                self.manager._process_serial_input(second)
+                assert seen == [1]
+
+        self.manager.dispatch_response.return_value = (cb, True)
+
+        self.manager._process_serial_input(first)
+
+        assert seen == [1, 2]
+        assert self.manager.read_buffer == bytearray()
+        assert self.manager._input_dispatch_active is False
 
 
 class TestWriter:
-    """Branch coverage for _writer."""
+    """Branch coverage for _writer and the deadline timer."""
 
     def setup_method(self):
         with patch('ace.serial_manager.serial'):
@@ -753,9 +833,8 @@ class TestWriter:
         self.manager.timeout_s = 1.0
         self.mock_reactor.monotonic.return_value = 2.0
 
-        ret = self.manager._writer(eventtime=0.0)
+        self.manager._deadline_check(eventtime=2.0)
 
-        assert ret == 0.0 + 0.1
         assert calls == [None]
         assert 1 not in self.manager.inflight
 
@@ -767,7 +846,7 @@ class TestWriter:
         self.manager.timeout_s = 1.0
         self.mock_reactor.monotonic.return_value = 2.0
 
-        self.manager._writer(eventtime=0.0)
+        self.manager._deadline_check(eventtime=2.0)
 
         assert any("Callback error" in args[0] for args, _ in self.mock_gcode.respond_info.call_args_list)
 
@@ -790,6 +869,234 @@ class TestWriter:
 
         self.manager._send_frame.assert_not_called()
 
+    def test_idle_writer_sleeps_until_woken(self):
+        ret = self.manager._writer(eventtime=1.0)
+
+        assert ret == self.mock_reactor.NEVER
+
+    def test_send_request_wakes_writer(self):
+        self.manager.writer_timer = "writer"
+
+        self.manager.send_request({"method": "get_status"}, Mock())
+        self.manager.send_high_prio_request({"method": "get_status"}, Mock())
+
+        assert self.mock_reactor.update_timer.call_count == 2
+        self.mock_reactor.update_timer.assert_called_with("writer", self.mock_reactor.NOW)
+
+    def test_dispatch_response_wakes_writer_when_slot_frees(self):
+        self.manager.writer_timer = "writer"
+        self.manager.inflight = {5: 0.0}
+        self.manager._callback_map = {5: Mock()}
+
+        self.manager.dispatch_response({"id": 5})
+
+        self.mock_reactor.update_timer.assert_called_once_with("writer", self.mock_reactor.NOW)
+
+    def test_unsolicited_dispatch_does_not_wake_writer(self):
+        self.manager.writer_timer = "writer"
+
+        self.manager.dispatch_response({"id": 5})
+
+        self.mock_reactor.update_timer.assert_not_called()
+
+    def test_send_arms_deadline_timer(self):
+        self.manager.deadline_timer = "deadline"
+        self.manager._next_deadline = self.mock_reactor.NEVER
+        self.manager.timeout_s = 5.0
+        self.manager.get_pending_request = Mock(side_effect=[({"method": "x"}, Mock()), (None, None)])
+
+        self.manager._writer(eventtime=1.0)
+
+        self.mock_reactor.update_timer.assert_called_once_with("deadline", 6.0)
+        assert self.manager._next_deadline == 6.0
+
+    def test_deadline_check_sleeps_until_next_expiry(self):
+        self.manager.deadline_timer = "deadline"
+        self.manager._supervision_enabled = False
+        self.manager.timeout_s = 5.0
+        self.manager.inflight = {1: 1.0, 2: 3.0}
+        self.mock_reactor.monotonic.return_value = 2.0
+
+        ret = self.manager._deadline_check(eventtime=2.0)
+
+        assert ret == 6.0
+        assert self.manager.inflight == {1: 1.0, 2: 3.0}
+
+    def test_deadline_check_idle_wakes_for_supervision_only(self):
+        self.manager.deadline_timer = "deadline"
+        self.manager._supervision_enabled = True
+        self.manager._supervision_check_and_recover = Mock()
+
+        ret = self.manager._deadline_check(eventtime=2.0)
+
+        assert ret == 2.0 + self.manager.SUPERVISION_CHECK_INTERVAL
+        self.manager._supervision_check_and_recover.assert_called_once()
+
+    def test_request_without_samples_uses_fixed_timeout(self):
+        self.manager.deadline_timer = "deadline"
+        self.manager._next_deadline = self.mock_reactor.NEVER
+        self.manager.get_pending_request = Mock(
+            side_effect=[({"method": "get_status"}, Mock()), (None, None)]
+        )
+
+        self.manager._writer(eventtime=1.0)
+
+        rid = next(iter(self.manager.inflight))
+        assert self.manager._inflight_timeouts[rid] == self.manager.timeout_s
+        assert self.manager._inflight_commands[rid] == "get_status"
+        assert rid not in self.manager._inflight_shortened
+        self.mock_reactor.update_timer.assert_called_once_with("deadline", 1.0 + self.manager.timeout_s)
+
+    def test_per_request_timeout_expires_only_short_request(self):
+        self.manager.inflight = {1: 0.0, 2: 0.0}
+        self.manager._inflight_timeouts = {1: 0.5, 2: 5.0}
+        self.manager._inflight_commands = {1: "get_status", 2: "feed_filament"}
+        self.manager._callback_map = {1: Mock(), 2: Mock()}
+
+        next_deadline = self.manager._expire_inflight(now=1.0)
+
+        assert list(self.manager.inflight) == [2]
+        assert next_deadline == 5.0
+        assert self.manager.rtt_estimator.snapshot()["get_status"]["timeouts"] == 1
+
+    def test_response_records_round_trip_sample(self):
+        self.manager.inflight = {7: 1.0}
+        self.manager._inflight_timeouts = {7: 1.0}
+        self.manager._inflight_commands = {7: "get_status"}
+        self.manager._callback_map = {7: Mock()}
+        self.mock_reactor.monotonic.return_value = 1.25
+
+        self.manager.dispatch_response({"id": 7})
+
+        stats = self.manager.rtt_estimator.snapshot()["get_status"]
+        assert stats["samples"] == 1
+        assert stats["srtt"] == pytest.approx(0.25)
+        assert 7 not in self.manager._inflight_timeouts
+
+    def test_pacing_is_opt_in(self):
+        assert not self.manager.tx_pacer.enabled
+
+    def test_frame_held_when_byte_budget_exhausted(self):
+        from ace.tx_pacer import AceTxPacer
+        self.manager.tx_pacer = AceTxPacer(rate_bytes_s=1000.0, burst_bytes=1024)
+        self.manager.tx_pacer.reserve(1024, now=0.0)
+        cb = Mock()
+        self.manager.get_pending_request = Mock(side_effect=[({"method": "ping"}, cb), (None, None)])
+
+        ret = self.manager._writer(eventtime=1.0)
+
+        self.manager._send_frame.assert_not_called()
+        assert self.manager.inflight == {}
+        assert self.manager.has_pending_requests()
+        req, held_cb, data, held_since = self.manager._paced_frame
+        assert held_cb is cb
+        assert ret == pytest.approx(1.0 + len(data) / 1000.0)
+
+        # Budget refilled: the held frame goes out before anything new
+        self.mock_reactor.monotonic.return_value = 1.0
+        self.manager._writer(eventtime=ret)
+
+        self.manager._send_frame.assert_called_once_with(req, data)
+        assert self.manager._paced_frame is None
+        assert req["id"] in self.manager.inflight
+        assert self.manager.tx_pacer.snapshot()["paced_frames"] == 1
+
+    def test_unencodable_request_fails_callback(self):
+        cb = Mock()
+        self.manager.protocol = Mock(wraps=self.manager.protocol)
+        self.manager.protocol.serialize_request_frame = Mock(side_effect=ValueError("no target"))
+        self.manager.get_pending_request = Mock(side_effect=[({"command": "GET_STATUS"}, cb), (None, None)])
+
+        self.manager._writer(eventtime=1.0)
+
+        cb.assert_called_once_with(response=None)
+        assert self.manager.inflight == {}
+        self.manager._send_frame.assert_not_called()
+
+    def test_clear_queues_drops_held_frame(self):
+        self.manager._paced_frame = ({"id": 1}, Mock(), b"x", 0.0)
+
+        self.manager.clear_queues()
+
+        assert not self.manager.has_pending_requests()
+
+    def test_clear_queues_resets_window_gauge(self):
+        self.manager.inflight = {1: 0.0, 2: 0.0}
+        self.manager.metrics.set_window(2)
+
+        self.manager.clear_queues()
+
+        assert self.manager.metrics._window_level == 0
+
+    def test_fixed_timeouts_when_adaptive_disabled(self):
+        self.manager.rtt_estimator.enabled = False
+        for _ in range(10):
+            self.manager.rtt_estimator.observe("get_status", 0.01)
+
+        command, timeout = self.manager._request_timeout({"method": "feed_filament"})
+
+        assert command == "feed_filament"
+        assert timeout == self.manager.timeout_s
+        assert self.manager._request_timeout({"method": "get_status"})[1] == self.manager.timeout_s
+
+    def test_only_coalescible_reads_are_shortened(self):
+        for _ in range(10):
+            self.manager.rtt_estimator.observe("get_status", 0.01)
+            self.manager.rtt_estimator.observe("feed_filament", 0.01)
+
+        assert self.manager._request_timeout({"method": "get_status"})[1] < self.manager.timeout_s
+        assert self.manager._request_timeout({"method": "feed_filament"})[1] == self.manager.timeout_s
+
+    def test_mutating_command_keeps_longer_adaptive_timeout(self):
+        for _ in range(10):
+            self.manager.rtt_estimator.observe("feed_filament", 8.0)
+
+        timeout = self.manager._request_timeout({"method": "feed_filament"})[1]
+
+        assert timeout > self.manager.timeout_s
+
+    def test_expired_request_wakes_writer(self):
+        self.manager.writer_timer = "writer"
+        self.manager.inflight = {1: 0.0}
+        self.manager._callback_map = {1: Mock()}
+        self.manager.timeout_s = 1.0
+
+        self.manager._expire_inflight(now=1.5)
+
+        self.mock_reactor.update_timer.assert_called_with("writer", self.mock_reactor.NOW)
+
+    def test_adaptive_timeout_not_counted_and_late_reply_absorbed(self):
+        cb = Mock()
+        self.manager.inflight = {3: 0.0}
+        self.manager._callback_map = {3: cb}
+        self.manager._inflight_timeouts = {3: 0.5}
+        self.manager._inflight_commands = {3: "get_status"}
+        self.manager._inflight_shortened = {3}
+
+        self.manager._expire_inflight(now=0.6)
+
+        cb.assert_called_once_with(response=None)
+        assert self.manager._comm_timeout_timestamps == []
+
+        self.mock_reactor.monotonic.return_value = 0.9
+        unsolicited = Mock(return_value=False)
+        self.manager.unsolicited_response_callback = unsolicited
+        self.manager._dispatch_incoming({"id": 3, "code": 0})
+
+        unsolicited.assert_not_called()
+        assert self.manager._comm_unsolicited_timestamps == []
+        assert self.manager.rtt_estimator.snapshot()["get_status"]["samples"] == 1
+
+    def test_fixed_timeout_still_counts_toward_supervision(self):
+        self.manager.inflight = {4: 0.0}
+        self.manager._callback_map = {4: Mock()}
+        self.manager.timeout_s = 1.0
+
+        self.manager._expire_inflight(now=1.5)
+
+        assert len(self.manager._comm_timeout_timestamps) == 1
+        assert self.manager._expired_early == {}
+
 
 class TestConnectionLifecycle:
     """Additional coverage for connection, queues, and send logic."""
@@ -863,6 +1170,7 @@ class TestConnectionLifecycle:
         self.mock_reactor.register_timer.side_effect = register_timer
         self.manager._reconnect_backoff = 5.0
         self.manager.auto_connect = Mock(return_value=False)
+        self.manager._device_enumerated = Mock(return_value=True)  # past the readiness probe
         self.mock_reactor.monotonic.return_value = 10.0
 
         self.manager.connect_to_ace(115200)
@@ -923,8 +1231,7 @@ class TestConnectionLifecycle:
         self.manager.reconnect.assert_called_once()
 
     def test_send_request_queue_full_logs(self):
-        self.manager._queue = Mock()
-        self.manager._queue.put.side_effect = queue.Full
+        self.manager._scheduler.maxsize = 0
         self.manager.send_request({"m": 1}, lambda r: None)
         assert any("Request queue full" in args[0] for args, _ in self.mock_gcode.respond_info.call_args_list)
 
@@ -935,6 +1242,7 @@ class TestConnectionLifecycle:
             port_description="ACE",
         )
         protocol.normalize_request.return_value = {"method": "normalized"}
+        protocol.get_coalesce_key.return_value = None
         self.manager.protocol = protocol
 
         callback = Mock()
@@ -1014,6 +1322,22 @@ class TestConnectionLifecycle:
         assert request['id'] == 10
         assert self.manager._request_id == 11
 
+    def test_send_frame_records_wire_traffic(self):
+        """Written frames and read chunks are captured when a recorder is attached."""
+        from ace.serial_manager import AceSerialManager
+        self.manager._send_frame = AceSerialManager._send_frame.__get__(self.manager, AceSerialManager)
+        self.manager._connected = True
+        self.manager._serial = Mock()
+        self.manager._serial.is_open = True
+        self.manager.wire_recorder = Mock()
+
+        self.manager._send_frame({"method": "ping", "id": 5})
+        self.manager._process_serial_input(b"\x00\x01")
+
+        sent = self.manager._serial.write.call_args[0][0]
+        self.manager.wire_recorder.record_tx.assert_called_once_with(sent)
+        self.manager.wire_recorder.record_rx.assert_called_once_with(b"\x00\x01")
+
     def test_send_frame_with_existing_id_preserves_it(self):
         """Test _send_frame doesn't overwrite existing request ID."""
         # Restore real _send_frame method for this test
@@ -1161,9 +1485,50 @@ class TestConnectionLifecycle:
             mgr.start_heartbeat = Mock()
             mgr.connect("/dev/ttyACM0", 115200)
             assert mgr.writer_timer is not None
-            assert mgr.reader_timer is not None
+            assert mgr.reader_fd_handle is not None
+            assert mgr.reader_timer is None
             mgr.start_heartbeat.assert_called_once()
 
+    def test_connect_timer_reader_mode_polls(self):
+        with patch('ace.serial_manager.serial') as mock_serial_mod:
+            mock_serial_mod.SerialTimeoutException = type("Timeout", (Exception,), {})
+            mock_serial_mod.SerialException = Exception
+            mock_serial_mod.Serial.return_value.is_open = True
+            from ace.serial_manager import AceSerialManager
+            mgr = AceSerialManager(self.mock_gcode, self.mock_reactor, 0, True, reader_mode="timer")
+            mgr.start_heartbeat = Mock()
+            mgr.connect("/dev/ttyACM0", 115200)
+            assert mgr.reader_fd_handle is None
+            assert mgr.reader_timer is not None
+            assert mgr.get_connection_status()["reader"]["mode"] == "timer"
+
+    def test_connect_falls_back_to_timer_without_fileno(self):
+        with patch('ace.serial_manager.serial') as mock_serial_mod:
+            mock_serial_mod.SerialTimeoutException = type("Timeout", (Exception,), {})
+            mock_serial_mod.SerialException = Exception
+            mock_serial_mod.Serial.return_value.is_open = True
+            mock_serial_mod.Serial.return_value.fileno.side_effect = OSError("no fd")
+            from ace.serial_manager import AceSerialManager
+            mgr = AceSerialManager(self.mock_gcode, self.mock_reactor, 0, True)
+            mgr.start_heartbeat = Mock()
+            mgr.connect("/dev/ttyACM0", 115200)
+            assert mgr.reader_fd_handle is None
+            assert mgr.reader_timer is not None
+
+    def test_disconnect_unregisters_reader_fd(self):
+        with patch('ace.serial_manager.serial') as mock_serial_mod:
+            mock_serial_mod.SerialTimeoutException = type("Timeout", (Exception,), {})
+            mock_serial_mod.SerialException = Exception
+            mock_serial_mod.Serial.return_value.is_open = True
+            from ace.serial_manager import AceSerialManager
+            mgr = AceSerialManager(self.mock_gcode, self.mock_reactor, 0, True)
+            mgr.start_heartbeat = Mock()
+            mgr.connect("/dev/ttyACM0", 115200)
+            handle = mgr.reader_fd_handle
+            mgr.disconnect()
+            self.mock_reactor.unregister_fd.assert_called_once_with(handle)
+            assert mgr.reader_fd_handle is None
+
     def test_fills_window_and_sends_requests(self):
         req = {"method": "ping"}
         cb = Mock()
@@ -1598,6 +1963,348 @@ class TestStatusUpdateChangeDetection:
         self.manager._status_update_callback(None)
 
 
+class TestRequestCoalescing:
+    """Idempotent reads queued or in flight share one frame and response."""
+
+    def setup_method(self):
+        with patch('ace.serial_manager.serial'):
+            from ace.serial_manager import AceSerialManager
+
+            self.mock_gcode = Mock()
+            self.mock_reactor = Mock()
+            self.mock_reactor.NOW = 10.0
+            self.mock_reactor.NEVER = 999.0
+            self.mock_reactor.monotonic.return_value = 0.0
+
+            self.manager = AceSerialManager(
+                gcode=self.mock_gcode,
+                reactor=self.mock_reactor,
+                instance_num=0,
+                ace_enabled=True
+            )
+        self.manager._send_frame = Mock()
+
+    def _queued_count(self):
+        return len(self.manager._scheduler)
+
+    def test_queued_duplicates_share_one_frame(self):
+        cb1, cb2 = Mock(), Mock()
+        self.manager.send_high_prio_request({"method": "get_status"}, cb1)
+        self.manager.send_high_prio_request({"method": "get_status"}, cb2)
+
+        assert self._queued_count() == 1
+        self.manager._writer(eventtime=0.0)
+        self.manager._send_frame.assert_called_once()
+
+        rid = self.manager._send_frame.call_args[0][0]["id"]
+        cb, solicited = self.manager.dispatch_response({"id": rid, "result": {"status": "ready"}})
+        cb(response={"id": rid, "result": {"status": "ready"}})
+
+        assert solicited is True
+        cb1.assert_called_once_with(response={"id": rid, "result": {"status": "ready"}})
+        cb2.assert_called_once_with(response={"id": rid, "result": {"status": "ready"}})
+        assert self.manager._coalesced == {}
+
+    def test_in_flight_read_absorbs_new_caller(self):
+        cb1, cb2 = Mock(), Mock()
+        self.manager.send_request({"method": "get_info"}, cb1)
+        self.manager._writer(eventtime=0.0)
+
+        self.manager.send_high_prio_request({"method": "get_info"}, cb2)
+
+        assert self._queued_count() == 0
+        rid = self.manager._send_frame.call_args[0][0]["id"]
+        cb, _ = self.manager.dispatch_response({"id": rid})
+        cb(response={"id": rid})
+        cb1.assert_called_once()
+        cb2.assert_called_once()
+        assert self.manager.get_connection_status()["coalesced_requests"] == 1
+
+    def test_waiters_get_independent_copies(self):
+        seen = []
+        def mutating_cb(response):
+            response["result"]["status"] = "mutated"
+        self.manager.send_request({"method": "get_status"}, mutating_cb)
+        self.manager.send_request({"method": "get_status"}, lambda response: seen.append(response))
+        self.manager._writer(eventtime=0.0)
+        rid = self.manager._send_frame.call_args[0][0]["id"]
+
+        cb, _ = self.manager.dispatch_response({"id": rid})
+        cb(response={"id": rid, "result": {"status": "ready"}})
+
+        assert seen[0]["result"]["status"] == "ready"
+
+    def test_superseded_heartbeat_calls_callback_once(self):
+        """Heartbeats merged by supersede deliver one callback per reply."""
+        self.manager.heartbeat_callback = Mock()
+        self.manager._send_heartbeat_request()
+        self.manager._send_heartbeat_request()
+
+        self.manager._writer(eventtime=0.0)
+        self.manager._send_frame.assert_called_once()
+        rid = self.manager._send_frame.call_args[0][0]["id"]
+        cb, _ = self.manager.dispatch_response({"id": rid})
+        cb(response={"id": rid})
+
+        self.manager.heartbeat_callback.assert_called_once_with({"id": rid})
+
+    def test_heartbeat_joining_in_flight_poll_calls_callback_once(self):
+        self.manager.heartbeat_callback = Mock()
+        self.manager._send_heartbeat_request()
+        self.manager._writer(eventtime=0.0)
+        self.manager._send_heartbeat_request()
+
+        assert self._queued_count() == 0
+        rid = self.manager._send_frame.call_args[0][0]["id"]
+        cb, _ = self.manager.dispatch_response({"id": rid})
+        cb(response={"id": rid})
+
+        self.manager.heartbeat_callback.assert_called_once_with({"id": rid})
+
+    def test_scheduler_uses_reactor_clock(self):
+        assert self.manager._scheduler._clock == self.mock_reactor.monotonic
+
+    def test_different_slots_not_coalesced(self):
+        self.manager.send_request({"method": "get_filament_info", "params": {"index": 0}}, Mock())
+        self.manager.send_request({"method": "get_filament_info", "params": {"index": 1}}, Mock())
+        self.manager.send_request({"method": "get_filament_info", "params": {"index": 0}}, Mock())
+
+        assert self._queued_count() == 2
+
+    def test_commands_with_side_effects_not_coalesced(self):
+        request = {"method": "start_feed_assist", "params": {"index": 0}}
+        self.manager.send_request(request, Mock())
+        self.manager.send_request(request, Mock())
+
+        assert self._queued_count() == 2
+
+    def test_high_prio_caller_promotes_queued_normal_read(self):
+        cb_normal, cb_hp = Mock(), Mock()
+        self.manager.send_request({"method": "feed_filament", "params": {"index": 0, "length": 5}}, Mock())
+        self.manager.send_request({"method": "get_status"}, cb_normal)
+        self.manager.send_high_prio_request({"method": "get_status"}, cb_hp)
+
+        self.manager._writer(eventtime=0.0)
+
+        sent = [c[0][0]["method"] for c in self.manager._send_frame.call_args_list]
+        # High-priority copy goes first; the normal-queue duplicate is dropped
+        assert sent == ["get_status", "feed_filament"]
+        assert self._queued_count() == 0
+
+    def test_timeout_fans_out_none(self):
+        cb1, cb2 = Mock(), Mock()
+        self.manager.send_request({"method": "get_status"}, cb1)
+        self.manager.send_request({"method": "get_status"}, cb2)
+        self.manager._writer(eventtime=0.0)
+
+        self.manager._expire_inflight(now=100.0)
+
+        cb1.assert_called_once_with(response=None)
+        cb2.assert_called_once_with(response=None)
+        assert self.manager._coalesced == {}
+
+    def test_callback_error_does_not_block_other_waiters(self):
+        cb2 = Mock()
+        self.manager.send_request({"method": "get_status"}, Mock(side_effect=RuntimeError("boom")))
+        self.manager.send_request({"method": "get_status"}, cb2)
+        self.manager._writer(eventtime=0.0)
+        rid = self.manager._send_frame.call_args[0][0]["id"]
+
+        cb, _ = self.manager.dispatch_response({"id": rid})
+        cb(response={"id": rid})
+
+        cb2.assert_called_once()
+        assert any("Callback error: boom" in args[0] for args, _ in self.mock_gcode.respond_info.call_args_list)
+
+    def test_new_read_after_response_is_sent_again(self):
+        self.manager.send_request({"method": "get_status"}, Mock())
+        self.manager._writer(eventtime=0.0)
+        rid = self.manager._send_frame.call_args[0][0]["id"]
+        cb, _ = self.manager.dispatch_response({"id": rid})
+        cb(response={"id": rid})
+
+        self.manager.send_request({"method": "get_status"}, Mock())
+
+        assert self._queued_count() == 1
+
+    def test_clear_queues_forgets_groups(self):
+        self.manager.send_request({"method": "get_status"}, Mock())
+
+        self.manager.clear_queues()
+
+        assert self.manager._coalesced == {}
+
+
+class TestSharedBusScheduling:
+    """ACE2 bus devices share the in-flight window fairly."""
+
+    def setup_method(self):
+        with patch('ace.serial_manager.serial'):
+            from ace.serial_manager import AceSerialManager
+            from ace.protocol_ace2 import AceProtoProtocolAdapter
+
+            self.mock_gcode = Mock()
+            self.mock_reactor = Mock()
+            self.mock_reactor.NOW = 10.0
+            self.mock_reactor.NEVER = 999.0
+            self.mock_reactor.monotonic.return_value = 0.0
+
+            self.manager = AceSerialManager(
+                gcode=self.mock_gcode,
+                reactor=self.mock_reactor,
+                instance_num=0,
+                ace_enabled=True,
+                protocol=AceProtoProtocolAdapter(),
+            )
+        self.manager._send_frame = Mock()
+
+    def _sent_devices(self):
+        return [c[0][0]["target_device_id"] for c in self.manager._send_frame.call_args_list]
+
+    def _feed(self, device_id):
+        return dict(self.manager.protocol.build_feed_filament_request(0, 10, 10), target_device_id=device_id)
+
+    def _status(self, device_id):
+        return dict(self.manager.protocol.build_get_status_request(), target_device_id=device_id)
+
+    def test_busy_device_cannot_hold_whole_window(self):
+        for _ in range(6):
+            self.manager.send_request(self._feed(1), Mock())
+        self.manager._writer(eventtime=0.0)
+        assert self._sent_devices() == [1] * self.manager.WINDOW_SIZE
+
+        # Device 2's heartbeat arrives while device 1 owns every slot
+        self.manager.send_high_prio_request(self._status(2), Mock())
+        first_rid = next(iter(self.manager.inflight))
+        self.manager.dispatch_response({"id": first_rid})
+        self.manager._writer(eventtime=0.1)
+
+        assert self._sent_devices()[-1] == 2
+
+    def test_device_cap_applies_only_with_competing_work(self):
+        for device_id in (1, 1, 1, 2):
+            self.manager.send_request(self._feed(device_id), Mock())
+
+        self.manager._writer(eventtime=0.0)
+
+        assert sorted(self._sent_devices()) == [1, 1, 1, 2]
+        flows = self.manager._queue_status()["flows"]
+        assert flows[1]["inflight"] == 3
+        assert flows[2]["inflight"] == 1
+
+    def test_forget_inflight_releases_device_slot(self):
+        self.manager.send_request(self._status(3), Mock())
+        self.manager._writer(eventtime=0.0)
+        rid = next(iter(self.manager.inflight))
+
+        with self.manager._lock:
+            self.manager._forget_inflight(rid)
+
+        assert self.manager._inflight_flows == {}
+
+
+class TestHotplugReconnect:
+    """Device events pull a pending reconnect forward."""
+
+    def setup_method(self):
+        with patch('ace.serial_manager.serial'):
+            from ace.serial_manager import AceSerialManager
+
+            self.mock_gcode = Mock()
+            self.mock_reactor = Mock()
+            self.mock_reactor.NOW = 0.0
+            self.mock_reactor.NEVER = 999.0
+            self.mock_reactor.monotonic.return_value = 100.0
+            self.mock_reactor.register_timer.return_value = "connect-timer"
+
+            self.manager = AceSerialManager(
+                gcode=self.mock_gcode,
+                reactor=self.mock_reactor,
+                instance_num=0,
+                ace_enabled=True,
+                hotplug=True,
+            )
+        self.manager._connected = False
+        self.manager._usb_location = "1-1.2:1.0"
+
+    def _schedule_reconnect(self):
+        self.manager.reconnect(delay=30.0)
+        return self.mock_reactor.register_timer.call_args[0][0]
+
+    def test_matching_device_triggers_connect_after_settle(self):
+        self._schedule_reconnect()
+        self.manager._get_usb_location_for_port = Mock(return_value="1-1.2:1.0")
+
+        self.manager._on_hotplug_event("/dev/ttyACM0")
+
+        self.mock_reactor.update_timer.assert_called_once_with(
+            "connect-timer", 100.0 + self.manager.HOTPLUG_SETTLE_S
+        )
+        assert self.manager._reconnect_trigger == "hotplug"
+
+    def test_other_usb_port_ignored(self):
+        self._schedule_reconnect()
+        self.manager._get_usb_location_for_port = Mock(return_value="1-1.3:1.0")
+
+        self.manager._on_hotplug_event("/dev/ttyACM1")
+
+        self.mock_reactor.update_timer.assert_not_called()
+
+    def test_ignored_while_connected_or_idle(self):
+        self.manager.connect_timer = None
+        self.manager._on_hotplug_event("/dev/ttyACM0")
+
+        self.mock_reactor.update_timer.assert_not_called()
+
+    def test_reconnect_keeps_watcher_but_shutdown_releases_it(self):
+        watcher = Mock()
+        self.manager.hotplug_watcher = watcher
+
+        self.manager.reconnect(delay=30.0)
+        watcher.stop.assert_not_called()
+
+        self.manager.wire_recorder = Mock()
+        self.manager.shutdown()
+        watcher.stop.assert_called_once()
+        assert self.manager.hotplug_watcher is None
+        self.manager.wire_recorder.close.assert_called_once()
+
+    def test_failed_hotplug_attempt_retries_without_backoff(self):
+        callback = self._schedule_reconnect()
+        self.manager._get_usb_location_for_port = Mock(return_value=None)
+        self.manager.auto_connect = Mock(return_value=False)
+        backoff = self.manager._reconnect_backoff
+
+        self.manager._on_hotplug_event("/dev/serial/by-path/platform-usb-0:1.2:1.0")
+        ret = callback(200.0)
+
+        assert ret == 200.0 + self.manager.HOTPLUG_SETTLE_S * 2
+        assert self.manager._reconnect_backoff == backoff
+        assert self.manager._hotplug_retries == self.manager.HOTPLUG_MAX_RETRIES - 1
+
+        self.manager._hotplug_retries = 0
+        assert callback(201.0) == 201.0 + backoff
+
+    def test_reconnect_duration_reported(self):
+        self.manager._disconnected_at = 98.0
+        self.manager._reconnect_trigger = "hotplug"
+
+        self.manager._record_reconnect_duration()
+
+        status = self.manager.get_connection_status()["hotplug"]
+        assert status["last_reconnect_s"] == pytest.approx(2.0)
+        assert status["last_reconnect_trigger"] == "hotplug"
+        assert self.manager._reconnect_trigger == "backoff"
+
+    def test_disconnect_marks_link_down_time(self):
+        self.manager._connected = True
+        self.manager._serial = Mock()
+
+        self.manager.disconnect()
+
+        assert self.manager._disconnected_at == 100.0
+
+
 class TestQueueManagement:
     """Test request queue management."""
 
@@ -1608,6 +2315,7 @@ class TestQueueManagement:
             
             self.mock_gcode = Mock()
             self.mock_reactor = Mock()
+            self.mock_reactor.monotonic.return_value = 0.0
             
             self.manager = AceSerialManager(
                 gcode=self.mock_gcode,
@@ -1648,12 +2356,48 @@ class TestQueueManagement:
         assert req is None
         assert cb is None
 
-    def test_clear_queue_handles_none(self):
-        """_clear_queue should handle None queue gracefully."""
-        # Should not raise exception
-        self.manager._clear_queue(None)
-        # Verify it returns early without error
-        assert True
+    def test_clear_queues_when_empty(self):
+        """clear_queues on an empty scheduler should be a no-op."""
+        self.manager.clear_queues()
+
+        assert not self.manager.has_pending_requests()
+
+    def test_stale_request_dropped_with_none_callback(self):
+        """A request queued past its max_wait is dropped, not sent."""
+        clock = [0.0]
+        self.manager._scheduler._clock = lambda: clock[0]
+        stale_cb = Mock()
+        fresh_cb = Mock()
+        self.manager.send_high_prio_request({"method": "stop_feed"}, stale_cb, max_wait=1.0)
+        self.manager.send_request({"method": "feed"}, fresh_cb)
+
+        clock[0] = 1.5
+        req, cb = self.manager.get_pending_request()
+
+        assert req["method"] == "feed"
+        assert cb is fresh_cb
+        stale_cb.assert_called_once_with(response=None)
+        assert self.manager._scheduler.snapshot()["high"]["dropped_stale"] == 1
+
+    def test_status_poll_superseded_by_next_poll(self):
+        """A newer poll replaces a queued one and inherits its waiters."""
+        clock = [0.0]
+        self.manager._scheduler._clock = lambda: clock[0]
+        first_cb = Mock()
+        second_cb = Mock()
+        self.manager.send_high_prio_request({"method": "get_status"}, first_cb, max_wait=1.0)
+        clock[0] = 1.0
+        self.manager.send_high_prio_request({"method": "get_status"}, second_cb, max_wait=1.0)
+
+        clock[0] = 1.5
+        req, group = self.manager.get_pending_request()
+        assert req["method"] == "get_status"
+        assert group.claim()
+        assert self.manager.get_pending_request() == (None, None)
+
+        group(response={"code": 0})
+        first_cb.assert_called_once_with(response={"code": 0})
+        second_cb.assert_called_once_with(response={"code": 0})
 
     def test_has_pending_requests_detects_queued(self):
         """has_pending_requests should detect queued items."""
@@ -1691,6 +2435,22 @@ class TestDispatchResponse:
                 ace_enabled=False
             )
 
+    def test_dispatch_records_round_trip_and_window(self):
+        """A solicited response feeds the latency histogram and window occupancy."""
+        self.mock_reactor.monotonic.return_value = 10.04
+        with self.manager._lock:
+            self.manager._callback_map[7] = Mock()
+            self.manager.inflight[7] = 10.0
+            self.manager._inflight_commands[7] = "get_status"
+
+        self.manager.dispatch_response({"id": 7, "result": {}})
+
+        metrics = self.manager.metrics.snapshot()
+        assert metrics["rtt"]["get_status"]["count"] == 1
+        assert metrics["rtt"]["get_status"]["p50_ms"] == 50.0
+        assert metrics["window"]["current"] == 0
+        assert "metrics" in self.manager.get_connection_status()
+
     def test_dispatch_returns_callback_for_known_id(self):
         """Dispatch should return callback for matching request ID."""
         mock_cb = Mock()
@@ -1736,6 +2496,7 @@ class TestOnConnectCallback:
             
             self.mock_gcode = Mock()
             self.mock_reactor = Mock()
+            self.mock_reactor.monotonic.return_value = 0.0
             
             self.manager = AceSerialManager(
                 gcode=self.mock_gcode,
@@ -1997,6 +2758,8 @@ class TestRetryLoopTimestampTracking:
                 ace_enabled=True
             )
             self.manager._baud = 115200
+            # Device present: attempts go straight to auto_connect, no probe wait
+            self.manager._device_enumerated = Mock(return_value=True)
 
     def test_connect_to_ace_retry_loop_tracks_timestamps(self):
         """Each failed retry in connect_to_ace callback should add a timestamp."""
@@ -2109,6 +2872,204 @@ class TestRetryLoopTimestampTracking:
         assert self.manager._reconnect_backoff == self.manager.RECONNECT_BACKOFF_MIN
 
 
+class TestStartupProbe:
+    """connect_to_ace readiness probe replacing the fixed first-attempt delay."""
+
+    def setup_method(self):
+        with patch('ace.serial_manager.serial'):
+            from ace.serial_manager import AceSerialManager
+
+            self.mock_gcode = Mock()
+            self.mock_reactor = Mock()
+            self.mock_reactor.monotonic.return_value = 1000.0
+            self.mock_reactor.NOW = 0.0
+            self.mock_reactor.NEVER = float('inf')
+            self.timer = {}
+
+            def register_timer(callback, when):
+                self.timer["cb"] = callback
+                self.timer["when"] = when
+                return "timer"
+
+            self.mock_reactor.register_timer = register_timer
+            self.manager = AceSerialManager(
+                gcode=self.mock_gcode,
+                reactor=self.mock_reactor,
+                instance_num=1,
+                ace_enabled=True,
+            )
+        self.ports = []
+        self.manager.port_inventory._lister = lambda: list(self.ports)
+        self.manager.auto_connect = Mock(return_value=True)
+
+    def _ace_port(self, n):
+        return SimpleNamespace(device=f"/dev/ttyACM{n}", description="ACE", hwid=f"LOCATION=1-1.{n}")
+
+    def test_first_attempt_is_immediate(self):
+        self.ports = [self._ace_port(0), self._ace_port(1)]
+
+        self.manager.connect_to_ace(115200, 2)
+
+        assert self.timer["when"] == self.mock_reactor.NOW
+        assert self.timer["cb"](1000.0) == self.mock_reactor.NEVER
+        self.manager.auto_connect.assert_called_once_with(1, 115200)
+
+    def test_waits_for_enough_devices_without_counting_failures(self):
+        self.ports = [self._ace_port(0)]  # instance 1 needs a second ACE
+        self.manager.connect_to_ace(115200, 2)
+
+        next_probe = self.timer["cb"](1000.0)
+
+        assert next_probe == pytest.approx(1000.0 + self.manager.STARTUP_PROBE_INTERVAL)
+        self.manager.auto_connect.assert_not_called()
+        assert self.manager._reconnect_timestamps == []
+
+        self.ports.append(self._ace_port(1))
+        self.mock_reactor.monotonic.return_value = next_probe
+        assert self.timer["cb"](next_probe) == self.mock_reactor.NEVER
+        self.manager.auto_connect.assert_called_once()
+
+    def test_probes_in_same_tick_share_one_enumeration(self):
+        self.ports = [self._ace_port(0)]
+        self.manager._device_enumerated()
+        self.manager._device_enumerated()  # e.g. a second instance's probe
+
+        assert self.manager.port_inventory.scans == 1
+
+    def test_falls_back_to_backoff_after_probe_window(self):
+        self.manager.auto_connect.return_value = False
+        self.manager.connect_to_ace(115200, 2)
+
+        result = self.timer["cb"](1002.5)
+
+        self.manager.auto_connect.assert_called_once()
+        assert result == pytest.approx(1002.5 + self.manager.RECONNECT_BACKOFF_MIN)
+        assert len(self.manager._reconnect_timestamps) == 1
+
+    def test_marks_startup_phases(self):
+        from ace.startup import AceStartupTimeline
+
+        timeline = AceStartupTimeline(self.mock_reactor.monotonic)
+        timeline.start([1])
+        self.manager.startup_timeline = timeline
+
+        self.manager._log_info_response({"code": 0, "result": {}})
+
+        assert timeline.elapsed(1, "info") == 0.0
+        assert timeline.elapsed(1, "open") is None
+
+    def test_shared_transport_marks_phases_for_every_bound_unit(self):
+        from ace.startup import AceStartupTimeline
+
+        timeline = AceStartupTimeline(self.mock_reactor.monotonic)
+        timeline.start([1, 2])
+        self.manager.startup_timeline = timeline
+        self.manager.startup_units = [1, 2]
+
+        self.manager._mark_startup("probe")
+
+        assert timeline.elapsed(1, "probe") == 0.0
+        assert timeline.elapsed(2, "probe") == 0.0
+
+
+
+class TestIoThreadMode:
+    """serial_reader_mode: thread hands I/O to AceSerialIoThread."""
+
+    def setup_method(self):
+        with patch('ace.serial_manager.serial'):
+            from ace.serial_manager import AceSerialManager
+
+            self.mock_gcode = Mock()
+            self.mock_reactor = Mock()
+            self.mock_reactor.NOW = 0.0
+            self.mock_reactor.NEVER = float('inf')
+            self.mock_reactor.monotonic.return_value = 0.0
+            self.manager = AceSerialManager(
+                gcode=self.mock_gcode,
+                reactor=self.mock_reactor,
+                instance_num=0,
+                ace_enabled=True,
+                reader_mode="thread",
+            )
+        self.io_thread = Mock()
+        self.io_thread.rx = collections.deque()
+        self.io_thread.bytes_read = 0
+        self.manager._io_thread = self.io_thread
+        self.manager._serial = Mock()
+        self.manager._connected = True
+
+    def test_send_frame_queues_on_io_thread(self):
+        self.manager._send_frame({"id": 4, "method": "ping"})
+
+        self.manager._serial.write.assert_not_called()
+        request_id, data = self.io_thread.send.call_args[0]
+        assert request_id == 4
+        assert data.startswith(b"\xFF\xAA")
+        assert self.manager.metrics.tx_frames == 0  # counted by the thread after the write
+
+    def test_drain_dispatches_responses_on_reactor(self):
+        cb = Mock()
+        self.manager.inflight = {4: 0.0}
+        self.manager._callback_map = {4: cb}
+        self.io_thread.rx.append(("response", {"id": 4, "code": 0}))
+
+        self.manager._drain_io_events(0.0)
+
+        self.io_thread.acknowledge_wake.assert_called_once()
+        cb.assert_called_once_with(response={"id": 4, "code": 0})
+        assert 4 not in self.manager.inflight
+        assert not self.io_thread.rx
+
+    def test_write_error_fails_inflight_request(self):
+        cb = Mock()
+        self.manager.inflight = {6: 0.0}
+        self.manager._callback_map = {6: cb}
+        self.io_thread.rx.append(("write_error", RuntimeError("stalled"), 6))
+
+        self.manager._drain_io_events(0.0)
+
+        cb.assert_called_once_with(response=None)
+        assert any("Serial write error: stalled" in args[0]
+                   for args, _ in self.mock_gcode.respond_info.call_args_list)
+
+    def test_read_error_stops_thread_and_reconnects(self):
+        self.manager._handle_read_failure = Mock()
+        self.io_thread.rx.append(("read_error", OSError("gone")))
+        self.io_thread.rx.append(("response", {"id": 1}))
+
+        self.manager._drain_io_events(0.0)
+
+        self.io_thread.stop.assert_called_once()
+        assert self.manager._io_thread is None
+        self.manager._handle_read_failure.assert_called_once_with(detail="gone")
+
+    def test_stop_hands_port_to_thread_and_reaps_later(self):
+        self.io_thread.port = self.manager._serial
+        self.io_thread.join.side_effect = [False, True]
+
+        self.manager.disconnect()
+
+        self.io_thread.stop.assert_called_once()
+        self.io_thread.port.close.assert_not_called()
+        assert self.manager._serial is None
+        assert self.manager._reap_io_threads(1.0) == 2.0
+        assert self.manager._reap_io_threads(2.0) == self.mock_reactor.NEVER
+        assert self.manager._retired_io_threads == []
+
+    def test_connection_status_reports_thread_mode(self):
+        assert self.manager.get_connection_status()["reader"]["mode"] == "thread"
+
+    def test_falls_back_to_fd_reader_when_thread_cannot_start(self):
+        self.manager._io_thread = None
+        self.manager._start_io_thread = Mock(side_effect=OSError("no pipe"))
+        self.manager._serial.fileno.return_value = 5
+
+        self.manager._start_reader()
+
+        assert self.manager._io_thread is None
+        assert self.manager.reader_fd_handle is not None
+
 class TestCommunicationSupervision:
     """Test communication health supervision functionality."""
     
@@ -2434,6 +3395,45 @@ class TestHeartbeat:
         # Should still return next event time
         assert result == 50.0 + 1.0
     
+    def test_heartbeat_tick_uses_policy_interval(self):
+        """The next poll comes from the heartbeat policy's current cadence."""
+        from ace.heartbeat_policy import AceHeartbeatPolicy
+
+        self.manager.heartbeat_policy = AceHeartbeatPolicy(1.0, busy_interval=0.2)
+        self.manager._send_heartbeat_request = Mock()
+        self.manager.heartbeat_policy.begin_wait(50.0)
+
+        assert self.manager._heartbeat_tick(eventtime=50.0) == pytest.approx(50.2)
+
+    def test_heartbeat_max_wait_follows_policy_cadence(self):
+        """A queued poll is only superseded after the current cadence, not the base one."""
+        from ace.heartbeat_policy import AceHeartbeatPolicy
+
+        policy = AceHeartbeatPolicy(1.0, busy_interval=0.2, idle_interval=5.0, idle_after=10.0)
+        self.manager.heartbeat_policy = policy
+        self.manager.send_high_prio_request = Mock()
+        policy.note_command(0.0)
+
+        self.manager._send_heartbeat_request()  # monotonic 100.0: idle
+
+        assert self.manager.send_high_prio_request.call_args[1]["max_wait"] == 5.0
+        assert policy.polls == {"busy": 0, "active": 0, "idle": 0}
+
+    def test_heartbeat_soon_pulls_idle_poll_forward(self):
+        """A command during the idle cadence reschedules the pending poll."""
+        from ace.heartbeat_policy import AceHeartbeatPolicy
+
+        self.manager.heartbeat_policy = AceHeartbeatPolicy(1.0, busy_interval=0.2)
+        self.manager.heartbeat_timer = "hb"
+        self.manager._next_heartbeat = 105.0
+        self.mock_reactor.monotonic.return_value = 100.0
+        self.mock_reactor.update_timer = Mock()
+
+        self.manager.heartbeat_soon()
+        self.manager.heartbeat_soon()
+
+        self.mock_reactor.update_timer.assert_called_once_with("hb", pytest.approx(100.2))
+
     def test_send_heartbeat_request_creates_correct_request(self):
         """Test send heartbeat request creates get_status request."""
         self.manager.send_high_prio_request = Mock()
@@ -0,0 +1,71 @@
+"""Tests for the startup phase timeline."""
+
+import pytest
+
+from ace.startup import AceStartupTimeline
+
+
+class TestAceStartupTimeline:
+    """Phase marking and report rendering."""
+
+    def setup_method(self):
+        self.now = 100.0
+        self.timeline = AceStartupTimeline(lambda: self.now)
+
+    def _mark_all(self, unit, times):
+        for phase, at in zip(AceStartupTimeline.PHASES, times):
+            self.now = 100.0 + at
+            self.timeline.mark(unit, phase)
+
+    def test_marks_ignored_before_start(self):
+        assert not self.timeline.mark(0, "open")
+        assert self.timeline.elapsed(0, "open") is None
+
+    def test_first_mark_wins(self):
+        self.timeline.start([0])
+        self.now = 100.4
+        assert self.timeline.mark(0, "status")
+        self.now = 130.0
+        assert not self.timeline.mark(0, "status")  # later reconnect
+
+        assert self.timeline.elapsed(0, "status") == pytest.approx(0.4)
+
+    def test_unknown_phase_ignored(self):
+        self.timeline.start([0])
+
+        assert not self.timeline.mark(0, "dryer")
+
+    def test_complete_when_every_unit_finished(self):
+        self.timeline.start([0, 1])
+        self._mark_all(0, [0.0, 0.01, 0.1, 0.1, 0.5])
+        assert not self.timeline.is_complete()
+
+        self._mark_all(1, [0.0, 0.02, 0.1, 0.1, 0.6])
+        assert self.timeline.is_complete()
+
+    def test_slowest_phase_uses_phase_duration(self):
+        self.timeline.start([0, 1])
+        self._mark_all(0, [0.0, 0.01, 0.1, 0.1, 0.5])
+        self._mark_all(1, [1.5, 1.52, 1.6, 1.6, 1.9])
+
+        unit, phase, spent = self.timeline.slowest_phase()
+
+        assert (unit, phase) == (1, "probe")
+        assert spent == pytest.approx(1.5)
+
+    def test_report_table(self):
+        self.timeline.start([0, 1])
+        self._mark_all(0, [0.0, 0.01, 0.12, 0.1, 0.85])
+        self.now = 100.3
+        self.timeline.mark(1, "probe")
+
+        lines = self.timeline.format_report()
+
+        assert lines[1].split() == ["unit", "probe", "open", "info", "status", "rfid"]
+        assert lines[2].split() == ["ACE[0]", "0.00", "0.01", "0.12", "0.10", "0.85"]
+        assert lines[3].split() == ["ACE[1]", "0.30", "-", "-", "-", "-"]
+        assert "Slowest phase: rfid on ACE[0] (0.75s)" in lines
+        assert lines[-1].startswith("Startup still in progress")
+
+    def test_report_without_start(self):
+        assert "no startup recorded" in self.timeline.format_report()[0]
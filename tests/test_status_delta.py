@@ -0,0 +1,79 @@
+"""Tests for heartbeat status change detection."""
+
+from ace.protocol_ace2 import AceProtoProtocolAdapter
+from ace.status_delta import AceStatusDelta
+
+
+def _status(**slot_status):
+    return {
+        "status": "ready",
+        "temp": 25,
+        "slots": [
+            {"index": i, "status": slot_status.get(f"s{i}", "empty"), "rfid": 0}
+            for i in range(4)
+        ],
+    }
+
+
+class TestAceStatusDelta:
+    """Per-slot dirty mask between consecutive GET_STATUS results."""
+
+    def setup_method(self):
+        self.delta = AceStatusDelta()
+
+    def test_first_sample_marks_everything_dirty(self):
+        assert self.delta.update(_status()) == (True, None)
+
+    def test_identical_result_is_unchanged(self):
+        self.delta.update(_status())
+
+        assert self.delta.update(_status()) == (False, frozenset())
+        assert self.delta.snapshot() == {"samples": 2, "unchanged": 1}
+
+    def test_dirty_mask_lists_changed_slots(self):
+        self.delta.update(_status())
+
+        assert self.delta.update(_status(s1="ready", s3="ready")) == (True, frozenset({1, 3}))
+
+    def test_header_change_with_clean_slots(self):
+        self.delta.update(_status())
+        changed = _status()
+        changed["temp"] = 40
+
+        assert self.delta.update(changed) == (True, frozenset())
+
+    def test_missing_slot_is_dirty(self):
+        self.delta.update(_status())
+        shorter = _status()
+        shorter["slots"].pop()
+
+        assert self.delta.update(shorter) == (True, frozenset({3}))
+
+    def test_unindexed_slots_fall_back_to_full_reconcile(self):
+        self.delta.update(_status())
+        odd = _status()
+        odd["slots"][0].pop("index")
+
+        assert self.delta.update(odd) == (True, None)
+
+    def test_reset_forgets_previous_result(self):
+        self.delta.update(_status())
+        self.delta.reset()
+
+        assert self.delta.update(_status()) == (True, None)
+
+    def test_lazy_ace2_result_is_compared_without_decoding(self):
+        adapter = AceProtoProtocolAdapter()
+        slot = b"\x08\x00\x10\x02"
+        idle = b"\x08\x01\x18\x1c" + b"\x4a\x04" + slot + b"\x4a\x04" + slot
+
+        self.delta.update(adapter._decode_response_payload("GET_STATUS", idle)["result"])
+        result = adapter._decode_response_payload("GET_STATUS", idle)["result"]
+
+        assert self.delta.update(result) == (False, frozenset())
+        assert "slots" in result._pending
+
+        feeding = b"\x08\x01\x18\x1c" + b"\x4a\x04" + slot + b"\x4a\x04\x08\x01\x10\x02"
+        assert self.delta.update(adapter._decode_response_payload("GET_STATUS", feeding)["result"]) == (
+            True, frozenset({1})
+        )
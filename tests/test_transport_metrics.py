@@ -0,0 +1,112 @@
+"""Tests for per-transport link metrics."""
+
+import pytest
+
+from ace.transport_metrics import AceLatencyHistogram, AceTransportMetrics
+
+
+class FakeClock:
+    def __init__(self):
+        self.now = 0.0
+
+    def __call__(self):
+        return self.now
+
+
+class TestAceLatencyHistogram:
+    """Bucketed round-trip latency with drift tracking."""
+
+    def test_buckets_and_percentiles(self):
+        histogram = AceLatencyHistogram()
+        for _ in range(19):
+            histogram.observe(0.008)
+        histogram.observe(0.3)
+
+        snapshot = histogram.snapshot()
+        assert snapshot["count"] == 20
+        assert snapshot["buckets"]["le_10ms"] == 19
+        assert snapshot["buckets"]["le_500ms"] == 1
+        assert snapshot["p50_ms"] == 10.0
+        assert snapshot["p95_ms"] == 10.0
+        assert histogram.percentile(1.0) == 500.0
+        assert snapshot["max_ms"] == pytest.approx(300.0)
+
+    def test_overflow_bucket_reports_max(self):
+        histogram = AceLatencyHistogram()
+        histogram.observe(7.5)
+
+        assert histogram.snapshot()["buckets"]["gt_5000ms"] == 1
+        assert histogram.percentile(0.5) == pytest.approx(7500.0)
+
+    def test_recent_average_follows_drift(self):
+        histogram = AceLatencyHistogram()
+        for _ in range(100):
+            histogram.observe(0.010)
+        for _ in range(60):
+            histogram.observe(0.050)
+
+        snapshot = histogram.snapshot()
+        assert snapshot["recent_ms"] > 40.0
+        assert snapshot["avg_ms"] < 30.0
+
+    def test_empty_histogram(self):
+        snapshot = AceLatencyHistogram().snapshot()
+        assert snapshot["count"] == 0
+        assert snapshot["p95_ms"] is None
+
+
+class TestAceTransportMetrics:
+    """Counters collected by the serial manager."""
+
+    def setup_method(self):
+        self.clock = FakeClock()
+        self.metrics = AceTransportMetrics(window_size=4, clock=self.clock)
+
+    def test_window_occupancy_is_time_weighted(self):
+        self.metrics.set_window(1)
+        self.clock.now = 1.0
+        self.metrics.set_window(3)
+        self.clock.now = 2.0
+        self.metrics.set_window(0)
+        self.clock.now = 4.0
+
+        window = self.metrics.snapshot()["window"]
+        assert window["avg"] == pytest.approx((1 * 1.0 + 3 * 1.0) / 4.0)
+        assert window["peak"] == 3
+        assert window["current"] == 0
+
+    def test_notices_are_classified(self):
+        for notice in ("Invalid CRC", "Resync: skipping 3 bytes", "Invalid frame tail, resyncing",
+                       "JSON decode error: x", "something else"):
+            self.metrics.record_notice(notice)
+
+        assert self.metrics.snapshot()["errors"] == {"crc": 1, "resync": 2, "decode": 1, "other": 1}
+
+    def test_traffic_and_timeouts(self):
+        self.metrics.record_tx(20)
+        self.metrics.record_rx(64, frames=1)
+        self.metrics.record_rtt("get_status", 0.012)
+        self.metrics.record_timeout("get_status")
+        self.metrics.record_timeout(None)
+
+        snapshot = self.metrics.snapshot()
+        assert snapshot["tx"] == {"frames": 1, "bytes": 20}
+        assert snapshot["rx"] == {"frames": 1, "bytes": 64}
+        assert snapshot["timeouts"] == {"get_status": 1, "unknown": 1}
+        assert snapshot["rtt"]["get_status"]["count"] == 1
+
+        summary = self.metrics.summary()
+        assert summary["rtt_avg_ms"] == pytest.approx(12.0)
+        assert summary["timeouts"] == 2
+        assert summary["tx_bytes"] == 20
+
+    def test_decode_time_per_frame(self):
+        self.metrics.record_decode(0.00002)
+        self.metrics.record_decode(0.00004)
+
+        assert self.metrics.snapshot()["decode"] == {
+            "frames": 2,
+            "avg_us": pytest.approx(30.0),
+            "max_us": pytest.approx(40.0),
+        }
+        assert self.metrics.summary()["decode_avg_us"] == pytest.approx(30.0)
@@ -0,0 +1,63 @@
+"""Tests for the outgoing byte budget (token bucket)."""
+
+import pytest
+
+from ace.tx_pacer import AceTxPacer
+
+
+class TestAceTxPacer:
+    """Frame pacing against the ACE input-buffer budget."""
+
+    def setup_method(self):
+        self.pacer = AceTxPacer(rate_bytes_s=1000.0, burst_bytes=1024)
+
+    def test_burst_fits_without_delay(self):
+        assert self.pacer.reserve(512, now=0.0) == 0.0
+        assert self.pacer.reserve(512, now=0.0) == 0.0
+
+    def test_exhausted_budget_returns_refill_delay(self):
+        self.pacer.reserve(1024, now=0.0)
+
+        delay = self.pacer.reserve(100, now=0.0)
+
+        assert delay == pytest.approx(0.1)
+        # Nothing consumed while waiting
+        assert self.pacer.reserve(100, now=0.1) == 0.0
+
+    def test_refill_capped_at_burst(self):
+        self.pacer.reserve(1024, now=0.0)
+
+        assert self.pacer.reserve(1024, now=100.0) == 0.0
+        assert self.pacer.reserve(1, now=100.0) > 0.0
+
+    def test_oversized_frame_sent_once_bucket_full(self):
+        self.pacer.reserve(10, now=0.0)
+
+        assert self.pacer.reserve(2000, now=0.0) == pytest.approx(0.01)
+        assert self.pacer.reserve(2000, now=0.01) == 0.0
+
+    def test_disabled_never_delays(self):
+        pacer = AceTxPacer(rate_bytes_s=0, burst_bytes=1024)
+        for _ in range(10):
+            assert pacer.reserve(1024, now=0.0) == 0.0
+
+        snap = pacer.snapshot()
+        assert snap["enabled"] is False
+        assert snap["bytes_sent"] == 10240
+
+    def test_paced_counters(self):
+        self.pacer.reserve(300, now=0.0)
+        self.pacer.record_paced(0.05)
+        self.pacer.record_paced(0.2)
+
+        snap = self.pacer.snapshot()
+        assert snap["frames_sent"] == 1
+        assert snap["paced_frames"] == 2
+        assert snap["paced_delay_s"] == pytest.approx(0.25)
+        assert snap["max_delay_s"] == pytest.approx(0.2)
+
+    def test_reset_refills(self):
+        self.pacer.reserve(1024, now=0.0)
+        self.pacer.reset()
+
+        assert self.pacer.reserve(1024, now=0.0) == 0.0
@@ -0,0 +1,226 @@
+"""Tests for wire traffic capture and offline replay."""
+
+import json
+import struct
+
+import pytest
+
+from ace.crc import crc16_mcrf4xx
+from ace.protocol_ace1 import AceJsonProtocolAdapter
+from ace.protocol_ace2 import AceProtoProtocolAdapter
+from ace.wire_recorder import (
+    WIRE_EVENT,
+    WIRE_RX,
+    WIRE_TX,
+    AceWireRecord,
+    AceWireRecorder,
+    AceWireReplay,
+    create_wire_recorder,
+    read_wire_log,
+)
+
+
+class FakeClock:
+    def __init__(self):
+        self.now = 100.0
+
+    def __call__(self):
+        return self.now
+
+
+def _ace1_response(request_id, result=None):
+    payload = json.dumps({"id": request_id, "code": 0, "msg": "success", "result": result or {}}).encode()
+    return (
+        b"\xFF\xAA" + struct.pack("<H", len(payload)) + payload
+        + struct.pack("<H", crc16_mcrf4xx(payload)) + b"\xFE"
+    )
+
+
+def _ace1_request(request_id, method="get_status"):
+    return AceJsonProtocolAdapter().serialize_request_frame({"id": request_id, "method": method}, crc16_mcrf4xx)
+
+
+class TestAceWireRecorder:
+    """Binary log format and rotation."""
+
+    def test_round_trip(self, tmp_path):
+        clock = FakeClock()
+        path = str(tmp_path / "ace0.acewire")
+        recorder = AceWireRecorder(path, "ace1_json", clock=clock)
+        recorder.record_event("connect /dev/ttyACM0 115200")
+        clock.now = 100.5
+        recorder.record_tx(b"\xFF\xAAtx")
+        clock.now = 100.52
+        recorder.record_rx(bytearray(b"rx-chunk"))
+        recorder.close()
+
+        protocol_name, records = read_wire_log(path)
+
+        assert protocol_name == "ace1_json"
+        assert records == [
+            AceWireRecord(WIRE_EVENT, 100.0, b"connect /dev/ttyACM0 115200"),
+            AceWireRecord(WIRE_TX, 100.5, b"\xFF\xAAtx"),
+            AceWireRecord(WIRE_RX, 100.52, b"rx-chunk"),
+        ]
+        assert recorder.snapshot()["records"] == 3
+
+    def test_flushes_periodically_and_ignores_records_after_close(self, tmp_path):
+        clock = FakeClock()
+        path = str(tmp_path / "ace0.acewire")
+        recorder = AceWireRecorder(path, "ace1_json", clock=clock)
+        recorder.record_rx(b"first")
+        clock.now += 0.5
+        recorder.record_rx(b"buffered")
+        assert [r.data for r in read_wire_log(path)[1]] == [b"first"]
+
+        clock.now += recorder.FLUSH_INTERVAL_S
+        recorder.record_rx(b"flushed")
+        assert [r.data for r in read_wire_log(path)[1]] == [b"first", b"buffered", b"flushed"]
+
+        recorder.close()
+        recorder.record_rx(b"late")  # e.g. from an I/O thread still winding down
+        assert not (tmp_path / "ace0.acewire.1").exists()
+        assert len(read_wire_log(path)[1]) == 3
+
+    def test_truncated_tail_is_dropped(self, tmp_path):
+        path = str(tmp_path / "ace0.acewire")
+        recorder = AceWireRecorder(path, "ace1_json")
+        recorder.record_rx(b"complete")
+        recorder.record_rx(b"cut short")
+        recorder.close()
+        with open(path, "r+b") as f:
+            f.truncate(f.seek(0, 2) - 3)
+
+        _, records = read_wire_log(path)
+
+        assert [r.data for r in records] == [b"complete"]
+
+    def test_rotation_caps_size_and_keeps_backups(self, tmp_path):
+        path = str(tmp_path / "ace0.acewire")
+        recorder = AceWireRecorder(path, "ace1_json", max_bytes=4096, backups=2)
+        chunk = b"x" * 1000
+        for _ in range(20):
+            recorder.record_rx(chunk)
+        recorder.close()
+
+        assert recorder.rotations >= 2
+        assert (tmp_path / "ace0.acewire.1").exists()
+        assert (tmp_path / "ace0.acewire.2").exists()
+        assert not (tmp_path / "ace0.acewire.3").exists()
+        for name in ("ace0.acewire", "ace0.acewire.1", "ace0.acewire.2"):
+            assert (tmp_path / name).stat().st_size <= 4096
+            assert read_wire_log(str(tmp_path / name))[0] == "ace1_json"
+
+    def test_existing_log_is_rotated_on_first_write(self, tmp_path):
+        path = str(tmp_path / "ace0.acewire")
+        first = AceWireRecorder(path, "ace1_json")
+        first.record_rx(b"old session")
+        first.close()
+
+        second = AceWireRecorder(path, "ace1_json")
+        second.record_rx(b"new session")
+        second.close()
+
+        assert [r.data for r in read_wire_log(path)[1]] == [b"new session"]
+        assert [r.data for r in read_wire_log(path + ".1")[1]] == [b"old session"]
+
+    def test_write_error_disables_recorder(self, tmp_path):
+        blocker = tmp_path / "not_a_dir"
+        blocker.write_text("")
+        recorder = AceWireRecorder(str(blocker / "ace0.acewire"), "ace1_json")
+
+        recorder.record_rx(b"data")
+        recorder.record_rx(b"more")
+
+        assert recorder.enabled is False
+        assert recorder.records == 0
+
+    def test_create_from_config(self, tmp_path):
+        assert create_wire_recorder({"wire_log_dir": ""}, "ace0", "ace1_json") is None
+
+        recorder = create_wire_recorder(
+            {"wire_log_dir": str(tmp_path), "wire_log_max_kb": 8, "wire_log_backups": 1},
+            "ace0",
+            "ace1_json",
+        )
+
+        assert recorder.path == str(tmp_path / "ace0_ace1_json.acewire")
+        assert recorder.max_bytes == 8192
+        assert recorder.backups == 1
+
+
+class TestAceWireReplay:
+    """Recorded sessions run through the real receive path."""
+
+    def test_ace1_session_matches_responses_and_measures_rtt(self):
+        response_1 = _ace1_response(1, {"status": "ready"})
+        response_2 = _ace1_response(2, {"status": "ready"})
+        corrupt = bytearray(_ace1_response(3))
+        corrupt[-3] ^= 0xFF
+        records = [
+            AceWireRecord(WIRE_EVENT, 10.0, b"connect /dev/ttyACM0 115200"),
+            AceWireRecord(WIRE_TX, 10.0, _ace1_request(1)),
+            AceWireRecord(WIRE_TX, 10.01, _ace1_request(2, "get_info")),
+            # First response split across reads, second glued to its tail
+            AceWireRecord(WIRE_RX, 10.03, response_1[:9]),
+            AceWireRecord(WIRE_RX, 10.04, response_1[9:] + response_2),
+            AceWireRecord(WIRE_RX, 10.05, bytes(corrupt) + _ace1_response(77)),
+            AceWireRecord(WIRE_TX, 10.06, _ace1_request(4)),
+        ]
+
+        result = AceWireReplay(AceJsonProtocolAdapter(), records).run()
+
+        assert result["tx_frames"] == 3
+        assert result["solicited"] == 2
+        assert result["unsolicited"] == 1
+        assert result["unanswered"] == 1
+        assert result["metrics"]["errors"]["crc"] == 1
+        assert result["metrics"]["rtt"]["get_status"]["max_ms"] == pytest.approx(40.0)
+        assert result["metrics"]["rtt"]["get_info"]["max_ms"] == pytest.approx(30.0)
+        assert result["recorded_seconds"] == pytest.approx(0.06)
+
+    def test_disconnect_event_clears_in_flight_requests(self):
+        records = [
+            AceWireRecord(WIRE_TX, 1.0, _ace1_request(1)),
+            AceWireRecord(WIRE_EVENT, 1.1, b"disconnect"),
+            AceWireRecord(WIRE_EVENT, 2.0, b"connect /dev/ttyACM0 115200"),
+            # The old id arrives after reconnect: no longer a pending request
+            AceWireRecord(WIRE_RX, 2.1, _ace1_response(1)),
+        ]
+
+        result = AceWireReplay(AceJsonProtocolAdapter(), records).run()
+
+        assert result["dropped_on_disconnect"] == 1
+        assert result["solicited"] == 0
+        assert result["unsolicited"] == 1
+        assert result["unanswered"] == 0
+        assert result["metrics"]["window"]["current"] == 0
+
+    def test_replay_is_deterministic(self):
+        records = [
+            AceWireRecord(WIRE_TX, 1.0, _ace1_request(5)),
+            AceWireRecord(WIRE_RX, 1.2, _ace1_response(5)),
+        ]
+        first = AceWireReplay(AceJsonProtocolAdapter(), records).run()
+        second = AceWireReplay(AceJsonProtocolAdapter(), records).run()
+
+        for key in ("solicited", "unsolicited", "unanswered", "metrics"):
+            assert first[key] == second[key]
+
+    def test_ace2_request_ids_are_matched(self):
+        adapter = AceProtoProtocolAdapter()
+        request = adapter.serialize_request_frame(
+            dict(adapter.build_get_status_request(), id=9, target_device_id=1), crc16_mcrf4xx
+        )
+        payload = b"\x08\x01"
+        inner = b"\x81" + struct.pack("<H", 9) + request[5:6] + bytes([len(payload)]) + payload
+        response = b"\xFF\xAA" + inner + struct.pack("<H", crc16_mcrf4xx(inner)) + b"\xFE"
+        records = [
+            AceWireRecord(WIRE_TX, 2.0, request),
+            AceWireRecord(WIRE_RX, 2.015, response),
+        ]
+
+        result = AceWireReplay(adapter, records).run()
+
+        assert result["solicited"] == 1
+        assert result["unanswered"] == 0
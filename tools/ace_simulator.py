@@ -0,0 +1,983 @@
+#!/usr/bin/env python3
+"""
+ace_simulator.py - Virtual ACE Pro units behind a pseudo-terminal.
+
+Emulates one ACE1 unit (JSON-RPC frames) or N ACE2 units sharing one
+RS-485 bridge (protobuf frames, DISCOVER_DEVICE / ASSIGN_DEVICE_ID), with
+the transport quirks from PROTOCOL.md:
+
+- a shared ~1024 byte buffer for input and unsent output; bytes arriving
+  while it is full are dropped
+- a frame header announcing more than 1024 bytes freezes the unit
+- a frame left incomplete for 3 s makes the unit reset its USB link
+  (the pty is closed and reopened; --link keeps a stable path)
+
+Feed, unwind and drying take real time (length / speed), so busy/ready
+transitions and wait_ready() behave as on hardware. Faults can be
+injected at fixed rates: dropped requests, corrupted response CRCs,
+garbage bytes between frames and responses split across writes.
+
+Usage:
+    python3 tools/ace_simulator.py --link /tmp/ttyACE0
+    python3 tools/ace_simulator.py --protocol ace2_proto --units 3 --latency 0.02
+    python3 tools/ace_simulator.py --drop-rate 0.01 --crc-error-rate 0.01 --garbage-rate 0.02
+    python3 tools/ace_simulator.py --soak 300 --rate 20    # drive it with AceSerialManager
+"""
+
+import argparse
+import collections
+import heapq
+import json
+import logging
+import os
+import pty
+import random
+import select
+import struct
+import sys
+import threading
+import time
+import tty
+
+sys.path.insert(0, os.path.abspath(os.path.join(os.path.dirname(__file__), "..")))
+
+from ace.crc import crc16_mcrf4xx  # noqa: E402
+from ace.protocol_ace2 import (  # noqa: E402
+    ACE2_COMMANDS_BY_CODE,
+    ACE2_FLAG_DEVICE_ID_MASK,
+    ACE2_FLAG_RESPONSE,
+    ACE2_GENERIC_RESPONSE_COMMANDS,
+    _pb_bytes,
+    _pb_decode,
+    _pb_first,
+    _pb_string,
+    _pb_uint32,
+    _pb_varint,
+)
+
+BUFFER_SIZE = 1024       # shared input/output buffer of the ACE (PROTOCOL.md)
+MAX_FRAME_PAYLOAD = 1024  # larger announced frames freeze the unit
+FRAME_STALL_S = 3.0      # incomplete frame for this long -> USB reset
+
+
+# ========== Device model ==========
+
+class SimSlot:
+    def __init__(self, index, material="PLA", color=(255, 255, 255), loaded=True):
+        self.index = index
+        self.loaded = loaded
+        self.material = material
+        self.color = list(color)
+        self.sku = f"SIM-{material}-{index}"
+
+
+class SimUnit:
+    """
+    State of one ACE: slots, the current motion, feed assist and dryer.
+
+    A motion (feed or unwind) lasts length / speed seconds and keeps the
+    unit busy; stop requests end it early. ``assist_is_busy`` reproduces
+    ACE2, which reports busy for as long as feed assist runs.
+    """
+
+    SLOT_COUNT = 4
+    MATERIALS = ("PLA", "PETG", "ABS", "TPU")
+    COLORS = ((255, 0, 0), (0, 255, 0), (0, 0, 255), (255, 255, 255))
+
+    def __init__(self, uid=(0, 0, 0), assist_is_busy=False):
+        self.uid = tuple(uid)
+        self.device_id = None
+        self.assist_is_busy = assist_is_busy
+        self.slots = [
+            SimSlot(i, self.MATERIALS[i], self.COLORS[i]) for i in range(self.SLOT_COUNT)
+        ]
+        self.motion = None  # (slot, "feeding" | "unwinding", ends_at)
+        self.assist_slot = None
+        self.feed_assist_count = 0
+        self.dryer = None  # (target_temp, duration_min, ends_at)
+        self.rfid_enabled = True
+        self.temp = 25
+
+    def tick(self, now):
+        if self.motion is not None and now >= self.motion[2]:
+            self.motion = None
+        if self.dryer is not None and now >= self.dryer[2]:
+            self.dryer = None
+        target = self.dryer[0] if self.dryer is not None else 25
+        self.temp = target if abs(self.temp - target) <= 2 else self.temp + (2 if target > self.temp else -2)
+
+    def valid_slot(self, index):
+        return isinstance(index, int) and 0 <= index < self.SLOT_COUNT
+
+    def start_motion(self, now, index, action, length, speed):
+        if not self.valid_slot(index) or not self.slots[index].loaded:
+            return False
+        duration = float(length) / float(speed) if speed and float(speed) > 0 else 0.0
+        self.motion = (index, action, now + max(0.0, duration))
+        return True
+
+    def stop_motion(self, index):
+        if self.motion is not None and self.motion[0] == index:
+            self.motion = None
+        if self.assist_slot == index:
+            self.assist_slot = None
+
+    def start_assist(self, index):
+        if not self.valid_slot(index):
+            return False
+        self.assist_slot = index
+        self.feed_assist_count += 1
+        return True
+
+    def start_drying(self, now, temp, duration_min):
+        if not temp:
+            self.dryer = None
+            return
+        self.dryer = (int(temp), int(duration_min), now + int(duration_min) * 60.0)
+
+    @property
+    def busy(self):
+        return self.motion is not None or (self.assist_is_busy and self.assist_slot is not None)
+
+    def dryer_remaining_min(self, now):
+        if self.dryer is None:
+            return 0
+        return max(0, int((self.dryer[2] - now) / 60.0 + 0.999))
+
+
+# ========== ACE1 JSON codec ==========
+
+class Ace1Codec:
+    """One ACE1 unit: ``FF AA | len(u16) | JSON | CRC | FE`` frames."""
+
+    name = "ace1_json"
+    MIN_FRAME = 7
+
+    def __init__(self, units):
+        self.unit = units[0]
+
+    @staticmethod
+    def header_length(buf):
+        """Announced payload length and total frame length, or None if short."""
+        if len(buf) < 4:
+            return None
+        payload_len = buf[2] | (buf[3] << 8)
+        return payload_len, 4 + payload_len + 3
+
+    @staticmethod
+    def decode(frame):
+        payload = frame[4:-3]
+        crc = frame[-3] | (frame[-2] << 8)
+        if frame[-1] != 0xFE or crc != crc16_mcrf4xx(payload):
+            return None
+        try:
+            return json.loads(payload.decode("utf-8"))
+        except (UnicodeDecodeError, ValueError):
+            return None
+
+    @staticmethod
+    def encode(response):
+        payload = json.dumps(response).encode("utf-8")
+        return (
+            b"\xFF\xAA" + struct.pack("<H", len(payload)) + payload
+            + struct.pack("<H", crc16_mcrf4xx(payload)) + b"\xFE"
+        )
+
+    def status(self, now):
+        unit = self.unit
+        slots = []
+        for slot in unit.slots:
+            slots.append({
+                "index": slot.index,
+                "status": "ready" if slot.loaded else "empty",
+                "sku": slot.sku if slot.loaded else "",
+                "brand": "SIM" if slot.loaded else "",
+                "type": slot.material if slot.loaded else "",
+                "color": slot.color if slot.loaded else [0, 0, 0],
+                "rfid": 2 if slot.loaded and unit.rfid_enabled else 0,
+            })
+        return {
+            "status": "busy" if unit.busy else "ready",
+            "action": unit.motion[1] if unit.motion is not None else "none",
+            "dryer_status": {
+                "status": "drying" if unit.dryer is not None else "stop",
+                "target_temp": unit.dryer[0] if unit.dryer is not None else 0,
+                "duration": unit.dryer[1] if unit.dryer is not None else 0,
+                "remain_time": unit.dryer_remaining_min(now),
+            },
+            "temp": unit.temp,
+            "enable_rfid": 1 if unit.rfid_enabled else 0,
+            "fan_speed": 7000 if unit.dryer is not None else 0,
+            "feed_assist_count": unit.feed_assist_count,
+            "cont_assist_time": 0.0,
+            "slots": slots,
+        }
+
+    def filament_info(self, index):
+        slot = self.unit.slots[index]
+        return {
+            "index": index,
+            "sku": slot.sku,
+            "brand": "SIM",
+            "type": slot.material,
+            "color": slot.color,
+            "colors": [slot.color + [255]],
+            "icon_type": 0,
+            "rfid": 2 if slot.loaded else 0,
+            "extruder_temp": {"min": 190, "max": 230},
+            "hotbed_temp": {"min": 50, "max": 70},
+            "diameter": 1.75,
+            "total": 330,
+            "current": 0,
+        }
+
+    def handle(self, request, now):
+        """Return the frames answering one decoded request (possibly none)."""
+        unit = self.unit
+        rid = request.get("id")
+        method = request.get("method")
+        params = request.get("params") or {}
+        index = params.get("index")
+        result = {}
+        code, msg = 0, "success"
+
+        if method == "get_info":
+            result = {
+                "id": 0, "slots": unit.SLOT_COUNT, "model": "Anycubic Color Engine Pro",
+                "firmware": "V1.3.82-sim", "boot_firmware": "V1.0.1",
+            }
+        elif method == "get_status":
+            result = self.status(now)
+        elif method == "get_filament_info":
+            if unit.valid_slot(index):
+                result = self.filament_info(index)
+            else:
+                code, msg = -1, "invalid index"
+        elif method in ("feed_filament", "unwind_filament"):
+            action = "feeding" if method == "feed_filament" else "unwinding"
+            if not unit.start_motion(now, index, action, params.get("length", 0), params.get("speed", 0)):
+                code, msg = -1, "invalid index"
+        elif method in ("stop_feed_filament", "stop_unwind_filament", "stop_feed_assist"):
+            unit.stop_motion(index)
+            if method == "stop_feed_assist":
+                msg = ""
+        elif method == "start_feed_assist":
+            if not unit.start_assist(index):
+                code, msg = -1, "invalid index"
+        elif method in ("update_feeding_speed", "update_unwinding_speed"):
+            pass
+        elif method == "drying":
+            unit.start_drying(now, params.get("temp", 0), params.get("duration", 0))
+            msg = "drying"
+        elif method == "drying_stop":
+            unit.start_drying(now, 0, 0)
+        elif method in ("enable_rfid", "disable_rfid"):
+            unit.rfid_enabled = method == "enable_rfid"
+        else:
+            code, msg = -1, f"unknown method {method}"
+
+        return [self.encode({"id": rid, "code": code, "msg": msg, "result": result})]
+
+
+# ========== ACE2 protobuf codec ==========
+
+def _pb_float(field, value):
+    return _pb_varint((field << 3) | 5) + struct.pack("<f", float(value))
+
+
+class Ace2Codec:
+    """
+    N ACE2 units on one bus: ``FF AA | flags | id(u16) | cmd | len | pb | CRC | FE``.
+
+    DISCOVER_DEVICE is answered by one unit without a device id per
+    request (each unit answers once per discovery round, lowest UID
+    first); ASSIGN_DEVICE_ID is taken by the unit with the given UID.
+    Addressed commands reach the unit whose device id is in the flags;
+    requests for unknown ids go unanswered, as on a real bus.
+    """
+
+    name = "ace2_proto"
+    MIN_FRAME = 10
+
+    def __init__(self, units):
+        self.units = units
+        self._answered_discovery = set()
+
+    @staticmethod
+    def header_length(buf):
+        if len(buf) < 7:
+            return None
+        payload_len = buf[6]
+        return payload_len, 7 + payload_len + 3
+
+    @staticmethod
+    def decode(frame):
+        inner = frame[2:-3]
+        crc = frame[-3] | (frame[-2] << 8)
+        if frame[-1] != 0xFE or crc != crc16_mcrf4xx(inner):
+            return None
+        spec = ACE2_COMMANDS_BY_CODE.get(frame[5])
+        return {
+            "flags": frame[2],
+            "id": frame[3] | (frame[4] << 8),
+            "command": spec.name if spec is not None else None,
+            "code": frame[5],
+            "fields": _pb_decode(bytes(frame[7:-3])),
+        }
+
+    @staticmethod
+    def encode(flags, rid, command_code, payload):
+        inner = bytes([flags, rid & 0xFF, (rid >> 8) & 0xFF, command_code, len(payload)]) + payload
+        return b"\xFF\xAA" + inner + struct.pack("<H", crc16_mcrf4xx(inner)) + b"\xFE"
+
+    def _status_payload(self, unit, now):
+        dryer = unit.dryer
+        dry = _pb_uint32(1, 2 if dryer is not None else 0)
+        if dryer is not None:
+            dry += _pb_uint32(2, dryer[0]) + _pb_uint32(3, dryer[1]) + _pb_uint32(4, unit.dryer_remaining_min(now))
+        payload = (
+            _pb_uint32(1, 2 if unit.busy else 1) + _pb_bytes(2, dry)
+            + _pb_uint32(3, unit.temp) + _pb_uint32(4, 40)
+            + _pb_uint32(7, unit.feed_assist_count)
+        )
+        for slot in unit.slots:
+            state = 0
+            if unit.motion is not None and unit.motion[0] == slot.index:
+                state = 1 if unit.motion[1] == "feeding" else 2
+            elif unit.assist_slot == slot.index:
+                state = 3
+            payload += _pb_bytes(9, _pb_uint32(1, state) + _pb_uint32(2, 2 if slot.loaded else 0))
+        return payload
+
+    def _filament_payload(self, unit, index):
+        slot = unit.slots[index]
+        r, g, b = slot.color
+        return (
+            _pb_uint32(1, index) + _pb_uint32(2, 1) + _pb_string(3, slot.sku)
+            + _pb_string(4, slot.material)
+            + _pb_bytes(5, _pb_uint32(1, (r << 24) | (g << 16) | (b << 8) | 0xFF))
+            + _pb_bytes(6, _pb_uint32(1, 190) + _pb_uint32(2, 230))
+            + _pb_bytes(7, _pb_uint32(1, 50) + _pb_uint32(2, 70))
+            + _pb_float(8, 1.75) + _pb_uint32(9, 330) + _pb_uint32(12, 0 if slot.loaded else 5)
+        )
+
+    def _unit_by_device_id(self, device_id):
+        for unit in self.units:
+            if unit.device_id == device_id:
+                return unit
+        return None
+
+    def handle(self, request, now):
+        rid = request["id"]
+        command = request["command"]
+        code = request["code"]
+        fields = request["fields"]
+        if command is None:
+            return []
+
+        if command == "DISCOVER_DEVICE":
+            candidates = sorted(
+                (unit for unit in self.units if unit.uid not in self._answered_discovery),
+                key=lambda unit: unit.uid,
+            )
+            if not candidates:
+                self._answered_discovery.clear()
+                return []
+            unit = candidates[0]
+            self._answered_discovery.add(unit.uid)
+            payload = _pb_uint32(1, unit.uid[0]) + _pb_uint32(2, unit.uid[1]) + _pb_uint32(3, unit.uid[2])
+            return [self.encode(ACE2_FLAG_RESPONSE, rid, code, payload)]
+
+        if command == "ASSIGN_DEVICE_ID":
+            uid = (_pb_first(fields, 1), _pb_first(fields, 2), _pb_first(fields, 3))
+            device_id = _pb_first(fields, 4)
+            for unit in self.units:
+                if unit.uid == uid:
+                    unit.device_id = device_id
+                    self._answered_discovery.discard(uid)
+                    return [self.encode(ACE2_FLAG_RESPONSE, rid, code, _pb_uint32(1, 0))]
+            return []
+
+        unit = self._unit_by_device_id(request["flags"] & ACE2_FLAG_DEVICE_ID_MASK)
+        if unit is None:
+            return []
+        flags = ACE2_FLAG_RESPONSE | unit.device_id
+        index = _pb_first(fields, 1, 0)
+
+        if command == "GET_STATUS":
+            return [self.encode(flags, rid, code, self._status_payload(unit, now))]
+        if command == "GET_INFO":
+            payload = _pb_string(1, "V2.0.0-sim") + _pb_string(2, "V1.0.0")
+            return [self.encode(flags, rid, code, payload)]
+        if command == "GET_FILAMENT_INFO":
+            if not unit.valid_slot(index):
+                return [self.encode(flags, rid, code, _pb_uint32(12, 1))]
+            return [self.encode(flags, rid, code, self._filament_payload(unit, index))]
+
+        result = 0
+        if command == "FEED_OR_ROLLBACK":
+            mode = _pb_first(fields, 4, 0)
+            if mode == 2:
+                ok = unit.start_assist(index)
+            else:
+                action = "feeding" if mode == 0 else "unwinding"
+                ok = unit.start_motion(now, index, action, _pb_first(fields, 3, 0), _pb_first(fields, 2, 0))
+            result = 0 if ok else 1
+        elif command == "STOP_FEED_OR_ROLLBACK":
+            unit.stop_motion(index)
+        elif command == "DRYING":
+            unit.start_drying(now, _pb_first(fields, 1, 0), _pb_first(fields, 2, 0))
+        elif command == "SET_RFID_ENABLE":
+            unit.rfid_enabled = bool(_pb_first(fields, 2, 1))
+        elif command not in ACE2_GENERIC_RESPONSE_COMMANDS:
+            return [self.encode(flags, rid, code, b"")]
+        return [self.encode(flags, rid, code, _pb_uint32(1, result))]
+
+
+# ========== Transport ==========
+
+class AceSimFaults:
+    """Injected fault rates (probability per frame) and toggles."""
+
+    def __init__(
+            self,
+            drop_rate=0.0,
+            crc_error_rate=0.0,
+            garbage_rate=0.0,
+            split_rate=0.0,
+            freeze_on_oversize=True,
+            reset_on_stall=True):
+        self.drop_rate = drop_rate
+        self.crc_error_rate = crc_error_rate
+        self.garbage_rate = garbage_rate
+        self.split_rate = split_rate
+        self.freeze_on_oversize = freeze_on_oversize
+        self.reset_on_stall = reset_on_stall
+
+
+class AceSimulator:
+    """
+    Serve simulated ACE units on a pty until stopped.
+
+    Requests are processed one at a time, each answered ``latency`` (plus
+    up to ``jitter``) seconds after the previous one finished, like the
+    single-threaded firmware. Input bytes, requests waiting for an answer
+    and unsent response bytes all count against ``buffer_size``.
+
+    run() serves on the calling thread; start()/stop() on a daemon thread.
+    ``counters`` keeps what happened for soak reports and tests.
+    """
+
+    def __init__(
+            self,
+            protocol="ace1_json",
+            units=1,
+            latency=0.01,
+            jitter=0.0,
+            buffer_size=BUFFER_SIZE,
+            faults=None,
+            link=None,
+            seed=None,
+            clock=time.monotonic):
+        if protocol == "ace2_proto":
+            sim_units = [SimUnit(uid=(0x1000 + n, 0x2000 + n, 0x3000 + n), assist_is_busy=True)
+                         for n in range(max(1, units))]
+            self.codec = Ace2Codec(sim_units)
+        else:
+            sim_units = [SimUnit()]
+            self.codec = Ace1Codec(sim_units)
+        self.units = sim_units
+        self.protocol = protocol
+        self.latency = max(0.0, latency)
+        self.jitter = max(0.0, jitter)
+        self.buffer_size = buffer_size
+        self.faults = faults or AceSimFaults()
+        self.link = link
+        self._random = random.Random(seed)
+        self._clock = clock
+        self.master_fd = None
+        self._slave_fd = None
+        self.slave_path = None
+        self._rx = bytearray()
+        self._partial_since = None
+        self._requests = collections.deque()  # (frame size, decoded request)
+        self._busy_until = 0.0
+        self._out = []  # heap of (due, seq, bytes)
+        self._out_seq = 0
+        self._out_bytes = 0
+        self.frozen = False
+        self._stop = threading.Event()
+        self._thread = None
+        self._wake_r, self._wake_w = os.pipe()
+        self.counters = collections.Counter()
+
+    # ---- pty lifecycle ----
+
+    @property
+    def path(self):
+        """Path clients should open (the stable link if configured)."""
+        return self.link or self.slave_path
+
+    def open(self):
+        master, slave = pty.openpty()
+        tty.setraw(slave)
+        os.set_blocking(master, False)
+        self.master_fd = master
+        self._slave_fd = slave  # held open so the master never sees EIO between clients
+        self.slave_path = os.ttyname(slave)
+        if self.link:
+            tmp = f"{self.link}.tmp"
+            if os.path.lexists(tmp):
+                os.remove(tmp)
+            os.symlink(self.slave_path, tmp)
+            os.replace(tmp, self.link)
+        logging.info("ACE simulator (%s) on %s", self.protocol, self.path)
+
+    def close(self):
+        for fd in (self.master_fd, self._slave_fd):
+            if fd is not None:
+                try:
+                    os.close(fd)
+                except OSError:
+                    pass
+        self.master_fd = self._slave_fd = None
+
+    def usb_reset(self):
+        """Drop the link like the ACE does after a stalled frame; clients must reopen."""
+        self.counters["usb_resets"] += 1
+        self.close()
+        self._rx.clear()
+        self._requests.clear()
+        self._out = []
+        self._out_bytes = 0
+        self._partial_since = None
+        self.frozen = False
+        self.open()
+
+    def start(self):
+        if self.master_fd is None:
+            self.open()
+        self._stop.clear()
+        self._thread = threading.Thread(target=self.run, name="ace-simulator", daemon=True)
+        self._thread.start()
+
+    def stop(self):
+        self._stop.set()
+        try:
+            os.write(self._wake_w, b".")
+        except OSError:
+            pass
+        if self._thread is not None:
+            self._thread.join(2.0)
+            self._thread = None
+        self.close()
+        for fd in (self._wake_r, self._wake_w):
+            try:
+                os.close(fd)
+            except OSError:
+                pass
+        if self.link and os.path.islink(self.link):
+            os.remove(self.link)
+
+    # ---- serving ----
+
+    def _occupied(self):
+        return len(self._rx) + sum(size for size, _ in self._requests) + self._out_bytes
+
+    def receive(self, data, now):
+        """Accept bytes from the host into the shared buffer and parse requests."""
+        if self.frozen:
+            self.counters["bytes_ignored_frozen"] += len(data)
+            return
+        space = max(0, self.buffer_size - self._occupied())
+        if len(data) > space:
+            self.counters["bytes_dropped"] += len(data) - space
+            data = data[:space]
+        self._rx += data
+        self.counters["bytes_received"] += len(data)
+        self._parse(now)
+
+    def _parse(self, now):
+        codec = self.codec
+        buf = self._rx
+        while True:
+            start = buf.find(b"\xFF\xAA")
+            if start < 0:
+                # Keep a trailing 0xFF that may start the next header
+                keep = 1 if buf.endswith(b"\xFF") else 0
+                if len(buf) > keep:
+                    self.counters["bytes_discarded"] += len(buf) - keep
+                del buf[:len(buf) - keep]
+                self._partial_since = None
+                return
+            if start:
+                self.counters["bytes_discarded"] += start
+                del buf[:start]
+            header = codec.header_length(buf)
+            if header is None:
+                self._partial_since = self._partial_since or now
+                return
+            payload_len, frame_len = header
+            if payload_len > MAX_FRAME_PAYLOAD and self.faults.freeze_on_oversize:
+                self.counters["oversize_freezes"] += 1
+                self.frozen = True
+                buf.clear()
+                return
+            if len(buf) < frame_len:
+                self._partial_since = self._partial_since or now
+                return
+            frame = bytes(buf[:frame_len])
+            del buf[:frame_len]
+            self._partial_since = None
+            request = codec.decode(frame)
+            if request is None:
+                self.counters["bad_frames"] += 1
+                continue
+            self.counters["requests"] += 1
+            self._requests.append((frame_len, request))
+
+    def _schedule(self, data, due):
+        if self.faults.crc_error_rate and self._random.random() < self.faults.crc_error_rate:
+            data = bytearray(data)
+            data[-3] ^= 0xFF
+            data = bytes(data)
+            self.counters["crc_errors_injected"] += 1
+        if self.faults.garbage_rate and self._random.random() < self.faults.garbage_rate:
+            data = bytes(self._random.getrandbits(8) for _ in range(self._random.randint(1, 16))) + data
+            self.counters["garbage_injected"] += 1
+        pieces = [data]
+        if self.faults.split_rate and len(data) > 2 and self._random.random() < self.faults.split_rate:
+            cut = self._random.randint(1, len(data) - 1)
+            pieces = [data[:cut], data[cut:]]
+            self.counters["splits_injected"] += 1
+        for n, piece in enumerate(pieces):
+            self._out_seq += 1
+            self._out_bytes += len(piece)
+            heapq.heappush(self._out, (due + n * 0.005, self._out_seq, piece))
+
+    def step(self, now):
+        """Advance device state, answer due requests and return the next wake time."""
+        for unit in self.units:
+            unit.tick(now)
+        if (self._partial_since is not None and now - self._partial_since >= FRAME_STALL_S):
+            self.counters["stalled_frames"] += 1
+            if self.faults.reset_on_stall and self.master_fd is not None:
+                self.usb_reset()
+                return now
+            self._rx.clear()
+            self._partial_since = None
+
+        while self._requests and not self.frozen and self._busy_until <= now:
+            _, request = self._requests.popleft()
+            if self.faults.drop_rate and self._random.random() < self.faults.drop_rate:
+                self.counters["requests_dropped"] += 1
+                continue
+            due = now + self.latency + (self._random.random() * self.jitter if self.jitter else 0.0)
+            for frame in self.codec.handle(request, now):
+                self._schedule(frame, due)
+                self.counters["responses"] += 1
+            self._busy_until = due
+
+        while self._out and self._out[0][0] <= now:
+            _, _, data = heapq.heappop(self._out)
+            self._out_bytes -= len(data)
+            self.write(data)
+
+        wake = now + 0.1
+        if self._out:
+            wake = min(wake, self._out[0][0])
+        if self._requests and not self.frozen:
+            wake = min(wake, max(now, self._busy_until))
+        return wake
+
+    def write(self, data):
+        if self.master_fd is None:
+            return
+        try:
+            os.write(self.master_fd, data)
+            self.counters["bytes_sent"] += len(data)
+        except OSError:
+            self.counters["write_errors"] += 1
+
+    def run(self):
+        if self.master_fd is None:
+            self.open()
+        wake = self._clock()
+        while not self._stop.is_set():
+            timeout = max(0.0, wake - self._clock())
+            fds = [self._wake_r] + ([self.master_fd] if self.master_fd is not None else [])
+            try:
+                readable, _, _ = select.select(fds, [], [], timeout)
+            except (OSError, ValueError):
+                readable = []
+            now = self._clock()
+            if self.master_fd is not None and self.master_fd in readable:
+                try:
+                    data = os.read(self.master_fd, 4096)
+                except OSError:
+                    data = b""
+                if data:
+                    self.receive(data, now)
+            wake = self.step(now)
+
+
+# ========== Soak driver ==========
+
+class SoakReactor:
+    """
+    Minimal single-threaded stand-in for klippy's reactor.
+
+    Enough for AceSerialManager: timers, fd callbacks, async callbacks from
+    other threads and pause(). Times are time.monotonic().
+    """
+
+    NOW = 0.0
+    NEVER = 9999999999999999.0
+
+    class _Timer:
+        def __init__(self, callback, waketime):
+            self.callback = callback
+            self.waketime = waketime
+
+    def __init__(self):
+        self._timers = []
+        self._fds = {}
+        self._async = collections.deque()
+        self._wake_r, self._wake_w = os.pipe()
+        os.set_blocking(self._wake_r, False)
+
+    def monotonic(self):
+        return time.monotonic()
+
+    def register_timer(self, callback, waketime=NEVER):
+        timer = self._Timer(callback, waketime)
+        self._timers.append(timer)
+        return timer
+
+    def update_timer(self, timer, waketime):
+        timer.waketime = waketime
+
+    def unregister_timer(self, timer):
+        if timer in self._timers:
+            self._timers.remove(timer)
+
+    def register_fd(self, fd, callback):
+        self._fds[fd] = callback
+        return fd
+
+    def unregister_fd(self, handle):
+        self._fds.pop(handle, None)
+
+    def register_async_callback(self, callback, waketime=NOW):
+        self._async.append(callback)
+        try:
+            os.write(self._wake_w, b".")
+        except OSError:
+            pass
+
+    def pause(self, waketime):
+        self.run_until(waketime)
+        return self.monotonic()
+
+    def run_until(self, end):
+        """Dispatch timers, async callbacks and fds until ``end`` (at least one pass)."""
+        first = True
+        while True:
+            now = self.monotonic()
+            if now >= end and not first:
+                return
+            first = False
+            for timer in list(self._timers):
+                if timer.waketime <= now and timer in self._timers:
+                    timer.waketime = self.NEVER
+                    timer.waketime = timer.callback(now)
+            while self._async:
+                self._async.popleft()(now)
+            next_wake = min([t.waketime for t in self._timers] + [end])
+            timeout = max(0.0, min(next_wake - self.monotonic(), 0.05))
+            try:
+                readable, _, _ = select.select(list(self._fds) + [self._wake_r], [], [], timeout)
+            except (OSError, ValueError):
+                readable = []
+            for fd in readable:
+                if fd == self._wake_r:
+                    try:
+                        os.read(self._wake_r, 512)
+                    except OSError:
+                        pass
+                elif fd in self._fds:
+                    self._fds[fd](self.monotonic())
+
+
+class _PrintGcode:
+    def __init__(self, verbose):
+        self.verbose = verbose
+        self.messages = collections.Counter()
+
+    def respond_info(self, msg):
+        kind = "timeout" if "TIMEOUT" in msg else "unsolicited" if "UNSOLICITED" in msg else "other"
+        self.messages[kind] += 1
+        if self.verbose:
+            print(msg)
+
+
+def run_soak(sim, duration, rate, reader_mode="fd", verbose=False):
+    """Drive ``sim`` with a real AceSerialManager for ``duration`` seconds."""
+    from ace.ace2_bus import Ace2BusBringUp, Ace2BusSession
+    from ace.port_inventory import AcePortInventory
+    from ace.protocol import create_protocol_adapter
+    from ace.serial_manager import AceSerialManager
+
+    reactor = SoakReactor()
+    gcode = _PrintGcode(verbose)
+    protocol = create_protocol_adapter(sim.protocol)
+    manager = AceSerialManager(
+        gcode, reactor, 0, protocol=protocol, reader_mode=reader_mode, hotplug=False,
+        port_inventory=AcePortInventory(lambda: []),
+    )
+    # The pty is not a USB device: skip enumeration and topology checks
+    manager.find_connection_port = lambda instance=0: sim.path
+    manager._device_enumerated = lambda: True
+    manager._validate_topology_position = lambda instance: True
+    manager._get_usb_location_for_port = lambda port: "pty"
+
+    shared_bus = protocol.get_transport_spec().shared_bus
+    device_ids = []
+    tally = collections.Counter()
+
+    def on_response(response):
+        tally["answered" if response is not None else "failed"] += 1
+
+    bus_session = Ace2BusSession(port=sim.path)
+    bringup_runs = []  # one stats dict per (re)connect
+
+    def on_bus_up(bringup):
+        bringup_runs.append(dict(bringup.stats))
+        device_ids[:] = [
+            device.device_id for device in bus_session.iter_discovered_devices()
+            if device.device_id is not None
+        ]
+
+    def assign_bus():
+        # Same bring-up the manager runs on connect: after a link reset the
+        # units still hold their ids, so the verify sweep should suffice
+        bindings = bus_session.export_bindings()
+        persisted_ids = bus_session.export_device_ids()
+        bus_session.reset()
+        bus_session.bind_persisted_instances(bindings)
+        Ace2BusBringUp(
+            bus_session,
+            protocol,
+            manager.send_high_prio_request,
+            list(range(len(sim.units))),
+            on_done=on_bus_up,
+            clock=reactor.monotonic,
+            log=gcode.respond_info,
+            persisted_ids=persisted_ids,
+        ).start()
+
+    if shared_bus:
+        manager.set_on_connect_callback(assign_bus)
+    manager.connect_to_ace(115200 if not shared_bus else 230400, delay=0)
+
+    interval = 1.0 / rate if rate > 0 else None
+    end = time.monotonic() + duration
+    n = 0
+    next_send = time.monotonic()
+    while time.monotonic() < end:
+        now = time.monotonic()
+        if interval is not None and now >= next_send and manager.is_connected():
+            request = protocol.build_get_status_request()
+            if shared_bus:
+                if not device_ids:
+                    request = None
+                else:
+                    request["target_device_id"] = device_ids[n % len(device_ids)]
+            if request is not None:
+                n += 1
+                tally["sent"] += 1
+                manager.send_request(request, on_response)
+        if interval is not None and now >= next_send:
+            next_send = now + interval
+        reactor.run_until(min(end, next_send if interval is not None else end))
+
+    reactor.run_until(time.monotonic() + 2.0)  # let the last requests finish
+    status = manager.get_connection_status()
+    manager.disconnect()
+    result = {
+        "requests": dict(tally),
+        "messages": dict(gcode.messages),
+        "transport": manager.metrics.summary(),
+        "rtt": {
+            command: {key: h[key] for key in ("count", "p50_ms", "p95_ms", "max_ms")}
+            for command, h in status["metrics"]["rtt"].items()
+        },
+        "simulator": dict(sim.counters),
+    }
+    if shared_bus:
+        result["bringup"] = bringup_runs
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Virtual ACE Pro on a pseudo-terminal")
+    parser.add_argument("--protocol", choices=("ace1_json", "ace2_proto"), default="ace1_json")
+    parser.add_argument("--units", type=int, default=1, help="ACE2 units on the bus")
+    parser.add_argument("--link", help="stable symlink to the pty (e.g. /tmp/ttyACE0)")
+    parser.add_argument("--latency", type=float, default=0.01, help="response latency (s)")
+    parser.add_argument("--jitter", type=float, default=0.0, help="random extra latency up to (s)")
+    parser.add_argument("--buffer-size", type=int, default=BUFFER_SIZE, help="shared device buffer (bytes)")
+    parser.add_argument("--drop-rate", type=float, default=0.0, help="fraction of requests ignored")
+    parser.add_argument("--crc-error-rate", type=float, default=0.0, help="fraction of responses with bad CRC")
+    parser.add_argument("--garbage-rate", type=float, default=0.0, help="fraction of responses after noise")
+    parser.add_argument("--split-rate", type=float, default=0.0, help="fraction of responses split in two writes")
+    parser.add_argument("--no-freeze", action="store_true", help="do not freeze on oversized frames")
+    parser.add_argument("--no-stall-reset", action="store_true", help="do not reset the link on stalled frames")
+    parser.add_argument("--seed", type=int, help="random seed for fault injection")
+    parser.add_argument("--soak", type=float, metavar="SECONDS", help="drive the simulator with AceSerialManager")
+    parser.add_argument("--rate", type=float, default=10.0, help="soak: status requests per second")
+    parser.add_argument("--reader-mode", choices=("fd", "timer", "thread"), default="fd")
+    parser.add_argument("--verbose", action="store_true")
+    args = parser.parse_args()
+
+    logging.basicConfig(level=logging.INFO if args.verbose else logging.WARNING)
+    sim = AceSimulator(
+        protocol=args.protocol,
+        units=args.units,
+        latency=args.latency,
+        jitter=args.jitter,
+        buffer_size=args.buffer_size,
+        faults=AceSimFaults(
+            drop_rate=args.drop_rate,
+            crc_error_rate=args.crc_error_rate,
+            garbage_rate=args.garbage_rate,
+            split_rate=args.split_rate,
+            freeze_on_oversize=not args.no_freeze,
+            reset_on_stall=not args.no_stall_reset,
+        ),
+        link=args.link,
+        seed=args.seed,
+    )
+
+    if args.soak:
+        sim.start()
+        try:
+            result = run_soak(sim, args.soak, args.rate, args.reader_mode, args.verbose)
+        finally:
+            sim.stop()
+        print(json.dumps(result, indent=2))
+        return
+
+    sim.open()
+    print(f"ACE simulator ({args.protocol}, {len(sim.units)} unit(s)) listening on {sim.path}")
+    try:
+        sim.run()
+    except KeyboardInterrupt:
+        pass
+    finally:
+        print(json.dumps(dict(sim.counters), indent=2))
+        sim.stop()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+"""
+ace_wire_replay.py - Replay a captured ACE serial session offline.
+
+Feeds a wire log written with ``wire_log_dir`` back through the serial
+manager's parser and response dispatch on the recorded clock, then prints
+the counts and latency figures. Rotated files are replayed in the order
+given (oldest first).
+
+Usage:
+    python3 tools/ace_wire_replay.py ~/printer_data/logs/ace/ace0_ace1_json.acewire
+    python3 tools/ace_wire_replay.py ace0_ace1_json.acewire.1 ace0_ace1_json.acewire --repeat 20
+    python3 tools/ace_wire_replay.py capture.acewire --json
+"""
+
+import argparse
+import json
+import os
+import sys
+
+sys.path.insert(0, os.path.abspath(os.path.join(os.path.dirname(__file__), "..")))
+
+from ace.protocol import create_protocol_adapter  # noqa: E402
+from ace.wire_recorder import AceWireReplay, read_wire_log  # noqa: E402
+
+
+def load_records(paths, protocol_override=None):
+    protocol_name = protocol_override
+    records = []
+    for path in paths:
+        name, file_records = read_wire_log(path)
+        if protocol_name is None:
+            protocol_name = name
+        elif protocol_override is None and name != protocol_name:
+            raise SystemExit(f"{path}: protocol {name} differs from {protocol_name}")
+        records.extend(file_records)
+    return protocol_name, records
+
+
+def print_summary(result, protocol_name, runs):
+    print(f"Protocol: {protocol_name}")
+    print(f"Recorded span: {result['recorded_seconds']:.1f}s, {result['events']} connect/disconnect events")
+    print(f"TX: {result['tx_frames']} frames ({result['tx_undecoded']} undecodable)")
+    print(f"RX: {result['rx_chunks']} chunks, {result['rx_bytes']} bytes")
+    print(
+        f"Responses: {result['solicited']} solicited, {result['unsolicited']} unsolicited, "
+        f"{result['unanswered']} requests unanswered, "
+        f"{result['dropped_on_disconnect']} dropped on disconnect"
+    )
+    errors = result["metrics"]["errors"]
+    print(
+        f"Frame errors: {errors['crc']} CRC, {errors['resync']} resync, "
+        f"{errors['decode']} decode, {errors['other']} other"
+    )
+    for command, rtt in result["metrics"]["rtt"].items():
+        print(
+            f"Latency {command}: p50 {rtt['p50_ms']:.0f}ms p95 {rtt['p95_ms']:.0f}ms "
+            f"avg {rtt['avg_ms']:.1f}ms max {rtt['max_ms']:.0f}ms (n={rtt['count']})"
+        )
+    rx_bytes = result["rx_bytes"] * runs
+    seconds = result["parse_seconds_total"]
+    rate = rx_bytes / seconds / 1e6 if seconds > 0 else 0.0
+    print(f"Receive path: {seconds * 1000:.1f}ms for {runs} run(s), {rate:.1f} MB/s")
+    decode = result["decode"]
+    print(f"Frame decode: avg {decode['avg_us']:.1f}us, max {decode['max_us']:.0f}us (last run, n={decode['frames']})")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Replay a captured ACE wire log")
+    parser.add_argument("logs", nargs="+", help="wire log files, oldest first")
+    parser.add_argument("--protocol", help="override the protocol named in the log header")
+    parser.add_argument("--repeat", type=int, default=1, help="replay N times (benchmarking)")
+    parser.add_argument("--json", action="store_true", help="print the result as JSON")
+    args = parser.parse_args()
+
+    protocol_name, records = load_records(args.logs, args.protocol)
+    runs = max(1, args.repeat)
+    total = 0.0
+    result = None
+    for _ in range(runs):
+        result = AceWireReplay(create_protocol_adapter(protocol_name), records).run()
+        total += result["parse_seconds"]
+    result["parse_seconds_total"] = total
+
+    if args.json:
+        print(json.dumps(result, indent=2, default=str))
+    else:
+        print_summary(result, protocol_name, runs)
+
+
+if __name__ == "__main__":
+    main()